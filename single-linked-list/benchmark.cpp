@@ -0,0 +1,201 @@
+// Микробенчмарки горячих операций SingleLinkedList.
+// Отдельная программа: компилируется так же, как main.cpp
+//     g++ -std=c++17 -O2 benchmark.cpp -o benchmark
+// Запуск:
+//     ./benchmark [максимальная длина списка]
+// Для каждой операции печатается ns/op и число байт, выделенных из кучи
+// (учёт через перегруженные глобальные operator new/delete), чтобы регрессии
+// горячих путей были видны до релиза, а не по жалобам из продакшена.
+
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include <string>
+
+#include "single-linked-list.h"
+
+// ---- Учёт выделений кучи ----------------------------------------------------
+
+static size_t g_allocated_bytes = 0;
+static size_t g_allocation_count = 0;
+
+void* operator new(size_t size)
+{
+	g_allocated_bytes += size;
+	++g_allocation_count;
+	void* ptr = std::malloc(size);
+	if (!ptr)
+	{
+		throw std::bad_alloc();
+	}
+	return ptr;
+}
+
+void operator delete(void* ptr) noexcept
+{
+	std::free(ptr);
+}
+
+void operator delete(void* ptr, size_t /*size*/) noexcept
+{
+	std::free(ptr);
+}
+
+// ---- Измеряемые нагрузки ----------------------------------------------------
+
+// 8-байтовый POD — типичный идентификатор
+using SmallPod = long long;
+
+// 64-байтовая структура — типичная «средняя» запись
+struct MediumStruct
+{
+	long long id = 0;
+	double values[7] = {};
+};
+
+inline bool operator==(const MediumStruct& lhs, const MediumStruct& rhs)
+{
+	return lhs.id == rhs.id;
+}
+
+// Фабрики значений по индексу, чтобы элементы не были одинаковыми
+template <typename Type>
+Type MakeValue(size_t index);
+
+template <>
+SmallPod MakeValue<SmallPod>(size_t index)
+{
+	return static_cast<SmallPod>(index);
+}
+
+template <>
+MediumStruct MakeValue<MediumStruct>(size_t index)
+{
+	MediumStruct result;
+	result.id = static_cast<long long>(index);
+	return result;
+}
+
+template <>
+std::string MakeValue<std::string>(size_t index)
+{
+	// Достаточно длинная строка, чтобы не срабатывала SSO
+	return "payload-payload-payload-" + std::to_string(index);
+}
+
+// ---- Харнес -----------------------------------------------------------------
+
+using Clock = std::chrono::steady_clock;
+
+struct Measurement
+{
+	double ns_per_op = 0.0;
+	size_t allocated_bytes = 0;
+};
+
+// Запускает body(), относя затраты к op_count операциям
+template <typename Body>
+Measurement Measure(size_t op_count, Body body)
+{
+	const size_t bytes_before = g_allocated_bytes;
+	const auto start = Clock::now();
+	body();
+	const auto finish = Clock::now();
+
+	Measurement result;
+	const auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(finish - start).count();
+	result.ns_per_op = static_cast<double>(elapsed) / static_cast<double>(op_count);
+	result.allocated_bytes = g_allocated_bytes - bytes_before;
+	return result;
+}
+
+void PrintRow(const char* payload, size_t length, const char* operation, const Measurement& m)
+{
+	std::printf("%-12s %10zu  %-22s %12.1f %14zu\n",
+		payload, length, operation, m.ns_per_op, m.allocated_bytes);
+}
+
+// Не даёт оптимизатору выбросить обход
+template <typename Type>
+volatile size_t g_sink = 0;
+
+template <typename Type>
+void RunSuite(const char* payload, size_t length)
+{
+	// PushFront в цикле построения
+	SingleLinkedList<Type> list;
+	PrintRow(payload, length, "PushFront", Measure(length, [&]
+	{
+		for (size_t i = 0; i < length; ++i)
+		{
+			list.PushFront(MakeValue<Type>(i));
+		}
+	}));
+
+	// InsertAfter за головой в цикле построения
+	{
+		SingleLinkedList<Type> built;
+		built.PushFront(MakeValue<Type>(0));
+		PrintRow(payload, length, "InsertAfter(begin)", Measure(length, [&]
+		{
+			for (size_t i = 0; i < length; ++i)
+			{
+				built.InsertAfter(built.cbegin(), MakeValue<Type>(i));
+			}
+		}));
+	}
+
+	// Полный обход через BasicIterator
+	PrintRow(payload, length, "Traverse", Measure(length, [&]
+	{
+		size_t visited = 0;
+		for (auto it = list.begin(); it != list.end(); ++it)
+		{
+			++visited;
+		}
+		g_sink<Type> = visited;
+	}));
+
+	// Копирование (CopyNodes) и operator==
+	{
+		SingleLinkedList<Type> copy;
+		PrintRow(payload, length, "CopyConstruct", Measure(length, [&]
+		{
+			SingleLinkedList<Type> local_copy(list);
+			copy = std::move(local_copy);
+		}));
+
+		PrintRow(payload, length, "operator==", Measure(length, [&]
+		{
+			g_sink<Type> = (copy == list) ? 1 : 0;
+		}));
+	}
+
+	// Очистка
+	PrintRow(payload, length, "Clear", Measure(length, [&]
+	{
+		list.Clear();
+	}));
+}
+
+int main(int argc, char* argv[])
+{
+	size_t max_length = 1'000'000;
+	if (argc > 1)
+	{
+		max_length = static_cast<size_t>(std::strtoull(argv[1], nullptr, 10));
+	}
+
+	std::printf("%-12s %10s  %-22s %12s %14s\n",
+		"payload", "length", "operation", "ns/op", "bytes alloc");
+
+	for (size_t length = 1'000; length <= max_length; length *= 10)
+	{
+		RunSuite<SmallPod>("int64", length);
+		RunSuite<MediumStruct>("struct64B", length);
+		RunSuite<std::string>("string", length);
+	}
+	return 0;
+}
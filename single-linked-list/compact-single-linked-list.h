@@ -0,0 +1,416 @@
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// Односвязный список со сжатыми 32-битными ссылками между узлами.
+//
+// Узлы живут не в куче поодиночке, а в едином непрерывном пуле (std::vector),
+// и поле next — это 32-битный индекс слота вместо 64-битного указателя.
+// Для маленьких типов это вдвое уменьшает узел: у CompactSingleLinkedList<int>
+// слот занимает 8 байт против 16 у обычного узла с указателем — вдвое больше
+// элементов на кеш-линию и прямое сокращение резидентной памяти.
+//
+// Бонусы индексов вместо указателей: перемещение и swap — O(1) (переезжает
+// весь пул, индексы остаются верными), а итераторы переживают рост пула.
+// Ограничение: не более ~4 млрд узлов в одном списке.
+//
+// Удалённые слоты встают во внутренний свободный список и переиспользуются;
+// пул не возвращает память ОС до Clear()/разрушения списка.
+//
+// Только для тривиально копируемых типов: рост пула перемещает слоты
+// побайтово, не вызывая конструкторы перемещения элементов
+template <typename Type>
+class CompactSingleLinkedList
+{
+	static_assert(std::is_trivially_copyable_v<Type>,
+		"CompactSingleLinkedList поддерживает только тривиально копируемые типы: рост пула перемещает слоты побайтово");
+
+private:
+	// «Нулевой указатель» и сентинел позиции перед первым элементом
+	static constexpr uint32_t kNullIndex = 0xFFFFFFFFu;
+	static constexpr uint32_t kBeforeBeginIndex = 0xFFFFFFFEu;
+
+	// Слот пула: сырое хранилище значения + сжатая ссылка на следующий слот.
+	// Значение конструируется на месте, поэтому Type не обязан быть
+	// default-constructible
+	struct Slot
+	{
+		alignas(Type) unsigned char storage[sizeof(Type)];
+		uint32_t next;
+	};
+
+	std::vector<Slot> slots_;
+	uint32_t head_next_ = kNullIndex; // индекс первого элемента
+	uint32_t free_head_ = kNullIndex; // цепочка свободных слотов (через Slot::next)
+	size_t size_ = 0;
+
+	[[nodiscard]] Type* ValuePtr(uint32_t index) noexcept
+	{
+		return reinterpret_cast<Type*>(slots_[index].storage);
+	}
+
+	[[nodiscard]] const Type* ValuePtr(uint32_t index) const noexcept
+	{
+		return reinterpret_cast<const Type*>(slots_[index].storage);
+	}
+
+	// Ссылка на поле next позиции index; для позиции before_begin — на голову
+	[[nodiscard]] uint32_t& NextRef(uint32_t index) noexcept
+	{
+		return (index == kBeforeBeginIndex) ? head_next_ : slots_[index].next;
+	}
+
+	// Выделяет слот: из свободной цепочки, если она не пуста, иначе ростом пула
+	[[nodiscard]] uint32_t AllocateSlot()
+	{
+		if (free_head_ != kNullIndex)
+		{
+			return std::exchange(free_head_, slots_[free_head_].next);
+		}
+		if (slots_.size() >= kBeforeBeginIndex)
+		{
+			throw std::length_error("CompactSingleLinkedList: исчерпан диапазон 32-битных индексов узлов");
+		}
+		slots_.emplace_back();
+		return static_cast<uint32_t>(slots_.size() - 1);
+	}
+
+	// Разрушает значение и возвращает слот в свободную цепочку
+	void ReleaseSlot(uint32_t index) noexcept
+	{
+		ValuePtr(index)->~Type();
+		slots_[index].next = free_head_;
+		free_head_ = index;
+	}
+
+	// Конструирует значение в новом слоте; при исключении слот возвращается
+	// в свободную цепочку, поэтому вставки дают строгую гарантию
+	template <typename... Args>
+	[[nodiscard]] uint32_t CreateSlot(uint32_t next, Args&&... args)
+	{
+		const uint32_t index = AllocateSlot();
+		try
+		{
+			new (static_cast<void*>(slots_[index].storage)) Type(std::forward<Args>(args)...);
+		}
+		catch (...)
+		{
+			slots_[index].next = free_head_;
+			free_head_ = index;
+			throw;
+		}
+		slots_[index].next = next;
+		return index;
+	}
+
+public:
+	using value_type = Type;
+
+	// Forward-итератор: контейнер + индекс. Индексы не инвалидируются ростом
+	// пула, поэтому итератор переживает вставки (в отличие от указательных схем)
+	template <typename ValueType>
+	class BasicIterator
+	{
+	private:
+		friend class CompactSingleLinkedList;
+
+		using ListPointer = std::conditional_t<std::is_const_v<ValueType>,
+			const CompactSingleLinkedList*, CompactSingleLinkedList*>;
+
+		ListPointer list_ = nullptr;
+		uint32_t index_ = kNullIndex;
+
+		BasicIterator(ListPointer list, uint32_t index) noexcept
+			: list_(list)
+			, index_(index)
+		{
+
+		}
+
+	public:
+		using iterator_category = std::forward_iterator_tag;
+		using value_type = Type;
+		using difference_type = std::ptrdiff_t;
+		using pointer = ValueType*;
+		using reference = ValueType&;
+
+		BasicIterator() = default;
+
+		BasicIterator(const BasicIterator<Type>& other) noexcept
+			: list_(other.list_)
+			, index_(other.index_)
+		{
+
+		}
+
+		BasicIterator& operator=(const BasicIterator& rhs) = default;
+
+		[[nodiscard]] bool operator==(const BasicIterator<const Type>& rhs) const noexcept
+		{
+			return index_ == rhs.index_ && (index_ == kNullIndex || list_ == rhs.list_);
+		}
+
+		[[nodiscard]] bool operator!=(const BasicIterator<const Type>& rhs) const noexcept
+		{
+			return !(*this == rhs);
+		}
+
+		[[nodiscard]] bool operator==(const BasicIterator<Type>& rhs) const noexcept
+		{
+			return index_ == rhs.index_ && (index_ == kNullIndex || list_ == rhs.list_);
+		}
+
+		[[nodiscard]] bool operator!=(const BasicIterator<Type>& rhs) const noexcept
+		{
+			return !(*this == rhs);
+		}
+
+		BasicIterator& operator++() noexcept
+		{
+			assert(list_ && index_ != kNullIndex);
+			index_ = (index_ == kBeforeBeginIndex) ? list_->head_next_ : list_->slots_[index_].next;
+			return *this;
+		}
+
+		BasicIterator operator++(int) noexcept
+		{
+			BasicIterator old_this(*this);
+			++(*this);
+			return old_this;
+		}
+
+		[[nodiscard]] reference operator*() const noexcept
+		{
+			assert(list_ && index_ < kBeforeBeginIndex);
+			return *const_cast<CompactSingleLinkedList*>(static_cast<const CompactSingleLinkedList*>(list_))->ValuePtr(index_);
+		}
+
+		[[nodiscard]] pointer operator->() const noexcept
+		{
+			return &(**this);
+		}
+	};
+
+	using Iterator = BasicIterator<Type>;
+	using ConstIterator = BasicIterator<const Type>;
+
+	// Сколько байт пула приходится на один узел (для контроля компрессии)
+	static constexpr size_t kBytesPerNode = sizeof(Slot);
+
+	CompactSingleLinkedList() = default;
+
+	CompactSingleLinkedList(std::initializer_list<Type> values)
+	{
+		uint32_t last = kBeforeBeginIndex;
+		for (const Type& value : values)
+		{
+			const uint32_t index = CreateSlot(kNullIndex, value);
+			NextRef(last) = index;
+			last = index;
+			++size_;
+		}
+	}
+
+	// Копия пересобирается плотно, в порядке списка: слоты идут подряд,
+	// и последующий обход копии максимально дружелюбен к кешу
+	CompactSingleLinkedList(const CompactSingleLinkedList& other)
+	{
+		slots_.reserve(other.size_);
+		uint32_t last = kBeforeBeginIndex;
+		for (const Type& value : other)
+		{
+			const uint32_t index = CreateSlot(kNullIndex, value);
+			NextRef(last) = index;
+			last = index;
+			++size_;
+		}
+	}
+
+	CompactSingleLinkedList& operator=(const CompactSingleLinkedList& rhs)
+	{
+		if (this != &rhs)
+		{
+			CompactSingleLinkedList temp(rhs);
+			swap(temp);
+		}
+		return *this;
+	}
+
+	// Перемещение — O(1): переезжает пул целиком, индексы остаются корректными
+	CompactSingleLinkedList(CompactSingleLinkedList&& other) noexcept
+		: slots_(std::move(other.slots_))
+		, head_next_(std::exchange(other.head_next_, kNullIndex))
+		, free_head_(std::exchange(other.free_head_, kNullIndex))
+		, size_(std::exchange(other.size_, 0))
+	{
+
+	}
+
+	CompactSingleLinkedList& operator=(CompactSingleLinkedList&& rhs) noexcept
+	{
+		if (this != &rhs)
+		{
+			CompactSingleLinkedList temp(std::move(rhs));
+			swap(temp);
+		}
+		return *this;
+	}
+
+	~CompactSingleLinkedList()
+	{
+		Clear();
+	}
+
+	// Обмен содержимым — O(1), как и у перемещения
+	void swap(CompactSingleLinkedList& other) noexcept
+	{
+		std::swap(slots_, other.slots_);
+		std::swap(head_next_, other.head_next_);
+		std::swap(free_head_, other.free_head_);
+		std::swap(size_, other.size_);
+	}
+
+	void PushFront(const Type& value)
+	{
+		head_next_ = CreateSlot(head_next_, value);
+		++size_;
+	}
+
+	void PushFront(Type&& value)
+	{
+		head_next_ = CreateSlot(head_next_, std::move(value));
+		++size_;
+	}
+
+	void PopFront() noexcept
+	{
+		assert(head_next_ != kNullIndex);
+		ReleaseSlot(std::exchange(head_next_, slots_[head_next_].next));
+		--size_;
+	}
+
+	// Вставляет элемент после pos. Возвращает итератор на вставленный элемент
+	Iterator InsertAfter(ConstIterator pos, const Type& value)
+	{
+		assert(pos.index_ != kNullIndex);
+		// Ссылку на поле next нельзя держать через CreateSlot:
+		// рост пула перемещает слоты
+		const uint32_t next = NextRef(pos.index_);
+		const uint32_t index = CreateSlot(next, value);
+		NextRef(pos.index_) = index;
+		++size_;
+		return Iterator(this, index);
+	}
+
+	// Удаляет элемент, следующий за pos. Возвращает итератор на элемент за удалённым
+	Iterator EraseAfter(ConstIterator pos) noexcept
+	{
+		assert(pos.index_ != kNullIndex);
+		uint32_t& link = NextRef(pos.index_);
+		assert(link != kNullIndex);
+		ReleaseSlot(std::exchange(link, slots_[link].next));
+		--size_;
+		return Iterator(this, link);
+	}
+
+	// Очищает список и возвращает память пула
+	void Clear() noexcept
+	{
+		for (uint32_t index = head_next_; index != kNullIndex; index = slots_[index].next)
+		{
+			ValuePtr(index)->~Type();
+		}
+		slots_.clear();
+		slots_.shrink_to_fit();
+		head_next_ = kNullIndex;
+		free_head_ = kNullIndex;
+		size_ = 0;
+	}
+
+	[[nodiscard]] size_t GetSize() const noexcept
+	{
+		return size_;
+	}
+
+	[[nodiscard]] bool IsEmpty() const noexcept
+	{
+		return size_ == 0;
+	}
+
+	[[nodiscard]] Iterator before_begin() noexcept
+	{
+		return Iterator(this, kBeforeBeginIndex);
+	}
+
+	[[nodiscard]] ConstIterator cbefore_begin() const noexcept
+	{
+		return ConstIterator(this, kBeforeBeginIndex);
+	}
+
+	[[nodiscard]] ConstIterator before_begin() const noexcept
+	{
+		return cbefore_begin();
+	}
+
+	[[nodiscard]] Iterator begin() noexcept
+	{
+		return (size_) ? Iterator(this, head_next_) : Iterator();
+	}
+
+	[[nodiscard]] Iterator end() noexcept
+	{
+		return Iterator();
+	}
+
+	[[nodiscard]] ConstIterator begin() const noexcept
+	{
+		return (size_) ? ConstIterator(this, head_next_) : ConstIterator();
+	}
+
+	[[nodiscard]] ConstIterator end() const noexcept
+	{
+		return ConstIterator();
+	}
+
+	[[nodiscard]] ConstIterator cbegin() const noexcept
+	{
+		return begin();
+	}
+
+	[[nodiscard]] ConstIterator cend() const noexcept
+	{
+		return end();
+	}
+};
+
+template <typename Type>
+void swap(CompactSingleLinkedList<Type>& lhs, CompactSingleLinkedList<Type>& rhs) noexcept
+{
+	lhs.swap(rhs);
+}
+
+template <typename Type>
+bool operator==(const CompactSingleLinkedList<Type>& lhs, const CompactSingleLinkedList<Type>& rhs)
+{
+	if (lhs.GetSize() != rhs.GetSize())
+	{
+		return false;
+	}
+	return std::equal(lhs.begin(), lhs.end(), rhs.begin());
+}
+
+template <typename Type>
+bool operator!=(const CompactSingleLinkedList<Type>& lhs, const CompactSingleLinkedList<Type>& rhs)
+{
+	return !(lhs == rhs);
+}
@@ -0,0 +1,231 @@
+#pragma once
+
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <mutex>
+#include <stdexcept>
+#include <vector>
+
+// Эпохальное отложенное освобождение памяти (epoch-based reclamation)
+// для конкурентного чтения списков.
+//
+// Проблема: EraseAfter/PopFront удаляют узел немедленно, хотя другой поток
+// может прямо сейчас стоять на нём итератором. Решение: удаляющий поток
+// не освобождает узел, а «отправляет его на пенсию» (Retire); физическое
+// удаление происходит только после того, как все читатели, заставшие узел
+// живым, покинули свои критические секции.
+//
+// Протокол:
+//  - читатель оборачивает обход списка в ReadGuard (RAII);
+//  - писатель вышивает узел из цепочки и вызывает Retire;
+//  - домен продвигает глобальную эпоху, когда все активные читатели
+//    перешли в текущую эпоху, и освобождает узлы, отставшие на две эпохи.
+//
+// Домен отвечает только за отложенное освобождение. Публиковать перешитые
+// ссылки писатель обязан атомарно: EraseAfterDeferred делает это
+// release-записью, а итераторы списка читают ссылки acquire-загрузкой,
+// поэтому пара «читатели под ReadGuard + один пишущий поток» свободна
+// и от гонок данных по next_node.
+//
+// Стоимость на стороне читателя — две атомарные записи на критическую секцию,
+// никаких блокировок. Писатели сериализуются коротким мьютексом, что приемлемо
+// для read-mostly нагрузок, ради которых подсистема и существует
+class EpochReclamationDomain
+{
+private:
+	// Максимум одновременно зарегистрированных потоков-читателей
+	static constexpr size_t kMaxThreads = 128u;
+	// Значение «поток вне критической секции»
+	static constexpr size_t kIdle = static_cast<size_t>(-1);
+
+	// Слот потока разнесён по кеш-линиям, чтобы читатели не толкались
+	struct alignas(64) ThreadSlot
+	{
+		std::atomic<size_t> local_epoch{kIdle};
+	};
+
+	// Отложенный к удалению объект: указатель + функция удаления
+	struct RetiredObject
+	{
+		void* ptr;
+		void (*deleter)(void*);
+	};
+
+	std::atomic<size_t> global_epoch_{0};
+	ThreadSlot slots_[kMaxThreads];
+
+	// Три корзины пенсионеров: текущая эпоха, предыдущая и освобождаемая
+	std::mutex retire_mutex_;
+	std::vector<RetiredObject> retired_[3];
+
+	// Реестр индексов слотов, общий для всех доменов: поток занимает индекс
+	// при первом обращении и возвращает его в свободный список при завершении,
+	// поэтому короткоживущие потоки (ротация в пуле потоков) не исчерпывают
+	// слоты — лимит kMaxThreads ограничивает только одновременно живые потоки
+	class ThreadSlotRegistry
+	{
+	private:
+		std::mutex mutex_;
+		std::vector<size_t> free_indices_;
+		size_t next_unused_ = 0;
+
+	public:
+		static ThreadSlotRegistry& Instance()
+		{
+			static ThreadSlotRegistry registry;
+			return registry;
+		}
+
+		size_t Acquire()
+		{
+			std::lock_guard<std::mutex> lock(mutex_);
+			if (!free_indices_.empty())
+			{
+				const size_t index = free_indices_.back();
+				free_indices_.pop_back();
+				return index;
+			}
+			if (next_unused_ == kMaxThreads)
+			{
+				// Слоты кончились — падаем громко, а не пишем за границу slots_
+				throw std::runtime_error("EpochReclamationDomain: превышен лимит одновременных потоков-читателей kMaxThreads");
+			}
+			return next_unused_++;
+		}
+
+		void Release(size_t index)
+		{
+			std::lock_guard<std::mutex> lock(mutex_);
+			free_indices_.push_back(index);
+		}
+	};
+
+	// RAII-аренда индекса слота на время жизни потока
+	struct SlotLease
+	{
+		size_t index = ThreadSlotRegistry::Instance().Acquire();
+
+		~SlotLease()
+		{
+			ThreadSlotRegistry::Instance().Release(index);
+		}
+	};
+
+	// Выдаёт потоку индекс слота при первом обращении; при завершении потока
+	// индекс возвращается в реестр и достаётся следующему потоку
+	static size_t GetThreadSlotIndex()
+	{
+		thread_local const SlotLease lease;
+		return lease.index;
+	}
+
+	// Пытается продвинуть глобальную эпоху. Возможно, только когда все читатели
+	// в критических секциях уже видят текущую эпоху. Вызывается под retire_mutex_
+	void TryAdvanceLocked()
+	{
+		const size_t global = global_epoch_.load(std::memory_order_acquire);
+		for (size_t i = 0; i < kMaxThreads; ++i)
+		{
+			const size_t local = slots_[i].local_epoch.load(std::memory_order_acquire);
+			if (local != kIdle && local != global)
+			{
+				// Читатель ещё в старой эпохе — продвигаться нельзя
+				return;
+			}
+		}
+		const size_t next = global + 1;
+		global_epoch_.store(next, std::memory_order_release);
+		// Корзина, отставшая на две эпохи, гарантированно не видна ни одному читателю
+		auto& to_free = retired_[(next + 1) % 3];
+		for (const auto& retired : to_free)
+		{
+			retired.deleter(retired.ptr);
+		}
+		to_free.clear();
+	}
+
+public:
+	EpochReclamationDomain() = default;
+
+	EpochReclamationDomain(const EpochReclamationDomain&) = delete;
+	EpochReclamationDomain& operator=(const EpochReclamationDomain&) = delete;
+
+	~EpochReclamationDomain()
+	{
+		// К моменту разрушения домена читателей быть не должно — добиваем всех пенсионеров
+		for (auto& bucket : retired_)
+		{
+			for (const auto& retired : bucket)
+			{
+				retired.deleter(retired.ptr);
+			}
+			bucket.clear();
+		}
+	}
+
+	// RAII-критическая секция читателя: пока Guard жив, ни один узел,
+	// который поток мог застать в списке, не будет физически удалён
+	class ReadGuard
+	{
+	private:
+		friend class EpochReclamationDomain;
+
+		EpochReclamationDomain& domain_;
+		size_t slot_index_;
+
+		explicit ReadGuard(EpochReclamationDomain& domain)
+			: domain_(domain)
+			, slot_index_(domain.GetThreadSlotIndex())
+		{
+			const size_t global = domain_.global_epoch_.load(std::memory_order_acquire);
+			domain_.slots_[slot_index_].local_epoch.store(global, std::memory_order_seq_cst);
+		}
+
+	public:
+		ReadGuard(const ReadGuard&) = delete;
+		ReadGuard& operator=(const ReadGuard&) = delete;
+
+		~ReadGuard()
+		{
+			domain_.slots_[slot_index_].local_epoch.store(kIdle, std::memory_order_release);
+		}
+	};
+
+	// Входит в критическую секцию чтения
+	[[nodiscard]] ReadGuard EnterRead()
+	{
+		return ReadGuard(*this);
+	}
+
+	// Откладывает удаление объекта до выхода всех читателей, заставших его живым.
+	// Объект должен быть уже вышит из структуры данных и недостижим для новых читателей
+	template <typename T>
+	void Retire(T* ptr)
+	{
+		std::lock_guard<std::mutex> lock(retire_mutex_);
+		const size_t global = global_epoch_.load(std::memory_order_acquire);
+		retired_[global % 3].push_back(RetiredObject{
+			ptr,
+			[](void* raw)
+			{
+				delete static_cast<T*>(raw);
+			}});
+		TryAdvanceLocked();
+	}
+
+	// Явная попытка продвинуть эпоху и освободить накопившихся пенсионеров
+	// (полезно звать периодически при редких Retire)
+	void Collect()
+	{
+		std::lock_guard<std::mutex> lock(retire_mutex_);
+		TryAdvanceLocked();
+	}
+
+	// Количество объектов, ожидающих освобождения (для тестов и телеметрии)
+	[[nodiscard]] size_t GetRetiredCount()
+	{
+		std::lock_guard<std::mutex> lock(retire_mutex_);
+		return retired_[0].size() + retired_[1].size() + retired_[2].size();
+	}
+};
@@ -0,0 +1,264 @@
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <utility>
+#include <vector>
+
+#include "single-linked-list.h"
+
+// Обёртка над SingleLinkedList с хеш-индексом принадлежности.
+//
+// Поверх цепочки узлов поддерживается хеш-таблица с открытой адресацией
+// (линейное пробирование, могильные камни при удалении), хранящая итераторы
+// на узлы списка. Все мутирующие операции перехватываются и синхронно обновляют
+// индекс, поэтому Contains(value) и FindNode(value) отвечают за O(1) в среднем
+// вместо O(N) обхода цепочки — и ручное сопровождение отдельного
+// std::unordered_set рядом со списком больше не нужно.
+//
+// Дубликаты значений поддерживаются: каждая вставка добавляет отдельную запись
+// индекса, удаление узла убирает ровно его запись
+template <typename Type, typename Hash = std::hash<Type>>
+class IndexedSingleLinkedList
+{
+private:
+	using List = SingleLinkedList<Type>;
+
+public:
+	using value_type = Type;
+	using Iterator = typename List::Iterator;
+	using ConstIterator = typename List::ConstIterator;
+
+private:
+	// Состояния ячейки открытой адресации
+	static constexpr uint8_t kEmpty = 0;     // никогда не занималась — конец пробы
+	static constexpr uint8_t kOccupied = 1;  // хранит итератор на живой узел
+	static constexpr uint8_t kTombstone = 2; // узел удалён, проба продолжается
+
+	struct Slot
+	{
+		Iterator it;
+		uint8_t state = kEmpty;
+	};
+
+	static constexpr size_t kInitialCapacity = 16u;
+
+	List list_;
+	std::vector<Slot> slots_ = std::vector<Slot>(kInitialCapacity);
+	size_t occupied_ = 0;   // живых записей
+	size_t used_ = 0;       // живых записей + могильных камней
+	Hash hasher_;
+
+	// Перестраивает таблицу под новую ёмкость, выбрасывая могильные камни
+	void Rehash(size_t new_capacity)
+	{
+		std::vector<Slot> old_slots = std::exchange(slots_, std::vector<Slot>(new_capacity));
+		// В свежей таблице нет ни записей, ни могильных камней: used_ пересчитает
+		// InsertSlot — каждая вставка попадает в пустую ячейку и инкрементирует его
+		used_ = 0;
+		for (const Slot& slot : old_slots)
+		{
+			if (slot.state == kOccupied)
+			{
+				InsertSlot(slot.it);
+			}
+		}
+	}
+
+	// Вставляет итератор в первую свободную ячейку пробной последовательности
+	void InsertSlot(Iterator it)
+	{
+		size_t index = hasher_(*it) % slots_.size();
+		while (slots_[index].state == kOccupied)
+		{
+			index = (index + 1) % slots_.size();
+		}
+		if (slots_[index].state == kEmpty)
+		{
+			++used_;
+		}
+		slots_[index].it = it;
+		slots_[index].state = kOccupied;
+	}
+
+	// Регистрирует узел в индексе, при необходимости расширяя таблицу
+	void IndexAdd(Iterator it)
+	{
+		// Держим заполненность (вместе с камнями) не выше половины
+		if ((used_ + 1) * 2 >= slots_.size())
+		{
+			// Если таблицу раздули камни — перестраиваем в ту же ёмкость
+			const size_t new_capacity = (occupied_ * 4 >= slots_.size()) ? slots_.size() * 2 : slots_.size();
+			Rehash(new_capacity);
+		}
+		InsertSlot(it);
+		++occupied_;
+	}
+
+	// Убирает из индекса запись, указывающую ровно на этот узел
+	void IndexRemove(ConstIterator victim)
+	{
+		size_t index = hasher_(*victim) % slots_.size();
+		while (slots_[index].state != kEmpty)
+		{
+			if (slots_[index].state == kOccupied && slots_[index].it == victim)
+			{
+				slots_[index].state = kTombstone;
+				--occupied_;
+				return;
+			}
+			index = (index + 1) % slots_.size();
+		}
+		// Индекс рассинхронизирован со списком — этого не должно случаться
+		assert(false);
+	}
+
+public:
+	IndexedSingleLinkedList() = default;
+
+	IndexedSingleLinkedList(std::initializer_list<Type> values)
+	{
+		for (auto it = std::rbegin(values); it != std::rend(values); ++it)
+		{
+			PushFront(*it);
+		}
+	}
+
+	// Копирование строит индекс заново: итераторы индекса оригинала
+	// указывают на чужие узлы и для копии непригодны
+	IndexedSingleLinkedList(const IndexedSingleLinkedList& other)
+		: list_(other.list_)
+		, hasher_(other.hasher_)
+	{
+		for (Iterator it = list_.begin(); it != list_.end(); ++it)
+		{
+			IndexAdd(it);
+		}
+	}
+
+	IndexedSingleLinkedList& operator=(const IndexedSingleLinkedList& rhs)
+	{
+		if (this != &rhs)
+		{
+			IndexedSingleLinkedList temp(rhs);
+			std::swap(list_, temp.list_);
+			std::swap(slots_, temp.slots_);
+			std::swap(occupied_, temp.occupied_);
+			std::swap(used_, temp.used_);
+			std::swap(hasher_, temp.hasher_);
+		}
+		return *this;
+	}
+
+	// Перемещение сохраняет индекс: узлы списка при перемещении не меняют адресов
+	IndexedSingleLinkedList(IndexedSingleLinkedList&&) noexcept = default;
+	IndexedSingleLinkedList& operator=(IndexedSingleLinkedList&&) noexcept = default;
+
+	// Вставляет элемент в начало списка и регистрирует его в индексе
+	void PushFront(const Type& value)
+	{
+		list_.PushFront(value);
+		IndexAdd(list_.begin());
+	}
+
+	// Вставляет элемент после pos и регистрирует его в индексе.
+	// Возвращает итератор на вставленный элемент
+	Iterator InsertAfter(ConstIterator pos, const Type& value)
+	{
+		const Iterator inserted = list_.InsertAfter(pos, value);
+		IndexAdd(inserted);
+		return inserted;
+	}
+
+	// Удаляет первый элемент, убирая его запись из индекса
+	void PopFront() noexcept
+	{
+		IndexRemove(list_.cbegin());
+		list_.PopFront();
+	}
+
+	// Удаляет элемент, следующий за pos, убирая его запись из индекса.
+	// Возвращает итератор на элемент за удалённым
+	Iterator EraseAfter(ConstIterator pos) noexcept
+	{
+		ConstIterator victim = pos;
+		++victim;
+		IndexRemove(victim);
+		return list_.EraseAfter(pos);
+	}
+
+	// Очищает список и индекс
+	void Clear() noexcept
+	{
+		list_.Clear();
+		slots_.assign(kInitialCapacity, Slot{});
+		occupied_ = 0;
+		used_ = 0;
+	}
+
+	// Проверяет принадлежность значения списку за O(1) в среднем
+	[[nodiscard]] bool Contains(const Type& value) const
+	{
+		return FindNode(value) != list_.end();
+	}
+
+	// Находит узел со значением value за O(1) в среднем.
+	// Возвращает итератор на него (end(), если значения нет).
+	// Изменять значение через итератор нельзя — оно является ключом индекса
+	[[nodiscard]] Iterator FindNode(const Type& value) const
+	{
+		size_t index = hasher_(value) % slots_.size();
+		while (slots_[index].state != kEmpty)
+		{
+			if (slots_[index].state == kOccupied && *slots_[index].it == value)
+			{
+				return slots_[index].it;
+			}
+			index = (index + 1) % slots_.size();
+		}
+		return Iterator();
+	}
+
+	[[nodiscard]] size_t GetSize() const noexcept
+	{
+		return list_.GetSize();
+	}
+
+	[[nodiscard]] bool IsEmpty() const noexcept
+	{
+		return list_.IsEmpty();
+	}
+
+	// Доступ к цепочке для чтения и обхода
+	[[nodiscard]] const List& GetList() const noexcept
+	{
+		return list_;
+	}
+
+	[[nodiscard]] ConstIterator begin() const noexcept
+	{
+		return list_.begin();
+	}
+
+	[[nodiscard]] ConstIterator end() const noexcept
+	{
+		return list_.end();
+	}
+
+	[[nodiscard]] ConstIterator cbegin() const noexcept
+	{
+		return list_.cbegin();
+	}
+
+	[[nodiscard]] ConstIterator cend() const noexcept
+	{
+		return list_.cend();
+	}
+
+	[[nodiscard]] ConstIterator cbefore_begin() const noexcept
+	{
+		return list_.cbefore_begin();
+	}
+};
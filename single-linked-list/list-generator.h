@@ -0,0 +1,226 @@
+#pragma once
+
+#include <type_traits>
+#include <utility>
+
+// Ленивые конвейеры по спискам на корутинах (C++20).
+// На компиляторах без поддержки корутин заголовок сводится к пустому
+#if defined(__cpp_impl_coroutine) && __has_include(<coroutine>)
+
+#include <coroutine>
+#include <exception>
+#include <iterator>
+
+// Генератор элементов, выдающий их по требованию: потребитель тянет следующий
+// элемент через итератор, и только тогда корутина-производитель продвигается.
+// Конвейеры Lazy() | Filtered() | Mapped() сшиваются из таких генераторов
+// в один проход по исходному списку: ни одного промежуточного списка
+// и ни одной аллокации узла на стадию (только кадры корутин — по одному
+// на стадию за весь конвейер, а не на элемент)
+template <typename Type>
+class ListGenerator
+{
+public:
+	struct promise_type
+	{
+		// Адрес текущего элемента: операнд co_yield живёт до возобновления
+		// корутины, поэтому указателя достаточно и для временных значений
+		const Type* current = nullptr;
+		std::exception_ptr exception;
+
+		ListGenerator get_return_object()
+		{
+			return ListGenerator(Handle::from_promise(*this));
+		}
+
+		std::suspend_always initial_suspend() noexcept
+		{
+			return {};
+		}
+
+		std::suspend_always final_suspend() noexcept
+		{
+			return {};
+		}
+
+		std::suspend_always yield_value(const Type& value) noexcept
+		{
+			current = &value;
+			return {};
+		}
+
+		void return_void() noexcept
+		{
+
+		}
+
+		void unhandled_exception()
+		{
+			exception = std::current_exception();
+		}
+	};
+
+	using Handle = std::coroutine_handle<promise_type>;
+
+	// Однопроходный входной итератор по элементам генератора
+	class Iterator
+	{
+	private:
+		friend class ListGenerator;
+
+		Handle handle_;
+
+		explicit Iterator(Handle handle) noexcept
+			: handle_(handle)
+		{
+
+		}
+
+	public:
+		using iterator_category = std::input_iterator_tag;
+		using value_type = Type;
+		using difference_type = std::ptrdiff_t;
+		using pointer = const Type*;
+		using reference = const Type&;
+
+		Iterator() = default;
+
+		// Итераторы равны, когда оба указывают на исчерпанный генератор (end())
+		[[nodiscard]] bool operator==(const Iterator& rhs) const noexcept
+		{
+			const bool lhs_done = !handle_ || handle_.done();
+			const bool rhs_done = !rhs.handle_ || rhs.handle_.done();
+			return lhs_done == rhs_done;
+		}
+
+		[[nodiscard]] bool operator!=(const Iterator& rhs) const noexcept
+		{
+			return !(*this == rhs);
+		}
+
+		Iterator& operator++()
+		{
+			handle_.resume();
+			if (handle_.done() && handle_.promise().exception)
+			{
+				std::rethrow_exception(handle_.promise().exception);
+			}
+			return *this;
+		}
+
+		[[nodiscard]] reference operator*() const noexcept
+		{
+			return *handle_.promise().current;
+		}
+
+		[[nodiscard]] pointer operator->() const noexcept
+		{
+			return handle_.promise().current;
+		}
+	};
+
+	using value_type = Type;
+
+	ListGenerator() = default;
+
+	// Генератор владеет кадром корутины и не копируется
+	ListGenerator(const ListGenerator&) = delete;
+	ListGenerator& operator=(const ListGenerator&) = delete;
+
+	ListGenerator(ListGenerator&& other) noexcept
+		: handle_(std::exchange(other.handle_, nullptr))
+	{
+
+	}
+
+	ListGenerator& operator=(ListGenerator&& rhs) noexcept
+	{
+		if (this != &rhs)
+		{
+			if (handle_)
+			{
+				handle_.destroy();
+			}
+			handle_ = std::exchange(rhs.handle_, nullptr);
+		}
+		return *this;
+	}
+
+	~ListGenerator()
+	{
+		if (handle_)
+		{
+			handle_.destroy();
+		}
+	}
+
+	// Продвигает корутину к первому элементу. Генератор однопроходный:
+	// повторный begin() продолжает с текущей позиции
+	[[nodiscard]] Iterator begin()
+	{
+		if (handle_ && !handle_.done())
+		{
+			handle_.resume();
+			if (handle_.done() && handle_.promise().exception)
+			{
+				std::rethrow_exception(handle_.promise().exception);
+			}
+		}
+		return Iterator(handle_);
+	}
+
+	[[nodiscard]] Iterator end() noexcept
+	{
+		return Iterator();
+	}
+
+private:
+	explicit ListGenerator(Handle handle) noexcept
+		: handle_(handle)
+	{
+
+	}
+
+	Handle handle_;
+};
+
+/*
+ * Ленивое представление контейнера: элементы выдаются по одному по мере
+ * запроса, без какого-либо копирования в промежуточные структуры.
+ * Контейнер должен пережить возвращённый генератор
+ */
+template <typename Container>
+ListGenerator<typename Container::value_type> Lazy(const Container& container)
+{
+	for (const auto& value : container)
+	{
+		co_yield value;
+	}
+}
+
+// Ленивая фильтрация: пропускает только элементы, для которых pred истинен.
+// Стадии сшиваются — источник продвигается ровно настолько, насколько тянет потребитель
+template <typename Type, typename Predicate>
+ListGenerator<Type> Filtered(ListGenerator<Type> source, Predicate pred)
+{
+	for (const Type& value : source)
+	{
+		if (pred(value))
+		{
+			co_yield value;
+		}
+	}
+}
+
+// Ленивое преобразование: выдаёт fn(элемент) для каждого элемента источника.
+// Тип результата выводится из fn, поэтому стадии можно менять тип значения
+template <typename Type, typename Fn>
+ListGenerator<std::decay_t<std::invoke_result_t<Fn&, const Type&>>> Mapped(ListGenerator<Type> source, Fn fn)
+{
+	for (const Type& value : source)
+	{
+		co_yield fn(value);
+	}
+}
+
+#endif // defined(__cpp_impl_coroutine) && __has_include(<coroutine>)
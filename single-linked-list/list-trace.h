@@ -0,0 +1,171 @@
+#pragma once
+
+// Сэмплирующие трассировочные хуки горячих путей списка.
+//
+// Слой включается только при сборке с -DSLL_ENABLE_TRACING: без него макрос
+// SLL_TRACE_SCOPE раскрывается в пустоту, и в нетрассируемой сборке не остаётся
+// ни байта кода. С включённым слоем операции сэмплируются 1 к 1024: несэмплируемый
+// вызов стоит один инкремент счётчика и проверку маски (доли наносекунды),
+// сэмплируемый добавляет запись с rdtsc-штампами начала и конца операции
+// в потоколокальный кольцевой буфер.
+//
+// Буфер потоколокален, поэтому запись свободна от блокировок и гонок
+// по построению; переполнение затирает самые старые записи. Телеметрический
+// агент забирает записи вызовом DrainListTrace() из того же потока
+// (например, в конце обработки запроса)
+
+#ifdef SLL_ENABLE_TRACING
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#else
+#include <chrono>
+#endif
+
+// constexpr-области нужны, чтобы хуки не мешали constexpr-методам списка (C++20);
+// в более ранних стандартах те методы и так не constexpr
+#if defined(__cpp_constexpr_dynamic_alloc) && __cpp_constexpr_dynamic_alloc >= 201907L
+#define SLL_TRACE_CONSTEXPR constexpr
+#else
+#define SLL_TRACE_CONSTEXPR
+#endif
+
+// Трассируемые операции списка
+enum class ListTraceOp : uint8_t
+{
+	kInsertAfter = 0,
+	kEraseAfter = 1,
+	kClear = 2,
+	kCopyConstruct = 3,
+	kTraverse = 4,
+};
+
+// Одна запись трассы: метки времени начала и конца операции
+struct ListTraceEvent
+{
+	uint64_t begin_tsc;
+	uint64_t end_tsc;
+	ListTraceOp op;
+};
+
+// Быстрая метка времени: счётчик тактов процессора, где он есть
+inline uint64_t ListTraceReadTsc() noexcept
+{
+#if defined(__x86_64__) || defined(__i386__)
+	return __rdtsc();
+#else
+	return static_cast<uint64_t>(
+		std::chrono::steady_clock::now().time_since_epoch().count());
+#endif
+}
+
+// Потоколокальный кольцевой буфер записей с сэмплированием 1 к 1024
+class ListTraceBuffer
+{
+public:
+	static constexpr size_t kCapacity = 1024u;    // записей в кольце (степень двойки)
+	static constexpr uint64_t kSampleEvery = 1024u; // доля сэмплируемых операций
+
+	// Буфер текущего потока
+	static ListTraceBuffer& ForThisThread() noexcept
+	{
+		thread_local ListTraceBuffer buffer;
+		return buffer;
+	}
+
+	// Решает, сэмплировать ли очередную операцию — горячий путь слоя:
+	// инкремент и проверка маски
+	[[nodiscard]] bool ShouldSample() noexcept
+	{
+		return (op_counter_++ & (kSampleEvery - 1u)) == 0u;
+	}
+
+	// Кладёт запись в кольцо; при переполнении затирается самая старая
+	void Record(ListTraceOp op, uint64_t begin_tsc, uint64_t end_tsc) noexcept
+	{
+		events_[head_] = ListTraceEvent{begin_tsc, end_tsc, op};
+		head_ = (head_ + 1u) & (kCapacity - 1u);
+		if (count_ < kCapacity)
+		{
+			++count_;
+		}
+	}
+
+	// Выгружает накопленные записи (от старых к новым) и очищает кольцо.
+	// Возвращает количество выгруженных записей
+	size_t Drain(std::vector<ListTraceEvent>& out)
+	{
+		const size_t drained = count_;
+		size_t index = (head_ + kCapacity - count_) & (kCapacity - 1u);
+		for (size_t i = 0; i < drained; ++i)
+		{
+			out.push_back(events_[index]);
+			index = (index + 1u) & (kCapacity - 1u);
+		}
+		count_ = 0;
+		return drained;
+	}
+
+private:
+	ListTraceEvent events_[kCapacity];
+	size_t head_ = 0;
+	size_t count_ = 0;
+	uint64_t op_counter_ = 0;
+};
+
+// RAII-области трассировки: штампует начало в конструкторе и конец
+// в деструкторе, если операция попала в сэмпл. В константных вычислениях
+// (constexpr-списки) превращается в no-op
+class ListTraceScope
+{
+public:
+	SLL_TRACE_CONSTEXPR explicit ListTraceScope(ListTraceOp op) noexcept
+		: op_(op)
+	{
+#if defined(__GNUC__) || defined(__clang__)
+		if (__builtin_is_constant_evaluated())
+		{
+			return;
+		}
+#endif
+		armed_ = ListTraceBuffer::ForThisThread().ShouldSample();
+		if (armed_)
+		{
+			begin_tsc_ = ListTraceReadTsc();
+		}
+	}
+
+	SLL_TRACE_CONSTEXPR ~ListTraceScope()
+	{
+		if (armed_)
+		{
+			ListTraceBuffer::ForThisThread().Record(op_, begin_tsc_, ListTraceReadTsc());
+		}
+	}
+
+	ListTraceScope(const ListTraceScope&) = delete;
+	ListTraceScope& operator=(const ListTraceScope&) = delete;
+
+private:
+	ListTraceOp op_;
+	bool armed_ = false;
+	uint64_t begin_tsc_ = 0;
+};
+
+// Выгружает трассу текущего потока для телеметрического агента
+inline size_t DrainListTrace(std::vector<ListTraceEvent>& out)
+{
+	return ListTraceBuffer::ForThisThread().Drain(out);
+}
+
+#define SLL_TRACE_SCOPE(op) ListTraceScope sll_trace_scope_(op)
+
+#else
+
+#define SLL_TRACE_SCOPE(op)
+
+#endif // SLL_ENABLE_TRACING
@@ -0,0 +1,113 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <utility>
+
+#include "single-linked-list.h"
+
+// Конкурентный собрат SingleLinkedList для схемы MPSC (много писателей — один читатель):
+// классический стек Трейбера. PushFront выполняется CAS-циклом над атомарной головой
+// и безопасен из любого числа потоков без мьютекса; StealAll атомарно забирает
+// всю накопленную цепочку одним exchange и отдаёт её потребителю
+// в виде обычного SingleLinkedList.
+// Узлы разделяются с SingleLinkedList (класс объявлен его другом),
+// поэтому передача цепочки не копирует ни одного значения
+template <typename Type>
+class LockFreeSingleLinkedList
+{
+private:
+	using List = SingleLinkedList<Type>;
+	using Node = typename List::Node;
+
+	// Атомарная голова цепочки. Писатели соревнуются только за этот указатель
+	std::atomic<Node*> head_{nullptr};
+	// Приблизительный счётчик элементов: обновляется после успешного CAS,
+	// поэтому в момент чтения может отставать на элементы «в полёте»
+	std::atomic<size_t> approx_size_{0};
+
+	// Вставляет готовый узел CAS-циклом
+	void PushNode(Node* node) noexcept
+	{
+		node->next_node = head_.load(std::memory_order_relaxed);
+		// При неудаче compare_exchange_weak сам перечитает голову в node->next_node
+		while (!head_.compare_exchange_weak(node->next_node, node,
+			std::memory_order_release, std::memory_order_relaxed))
+		{
+		}
+		approx_size_.fetch_add(1, std::memory_order_relaxed);
+	}
+
+public:
+	LockFreeSingleLinkedList() = default;
+
+	// Конкурентный контейнер не копируется и не перемещается:
+	// безопасной атомарной семантики для этого не существует
+	LockFreeSingleLinkedList(const LockFreeSingleLinkedList&) = delete;
+	LockFreeSingleLinkedList& operator=(const LockFreeSingleLinkedList&) = delete;
+
+	~LockFreeSingleLinkedList()
+	{
+		// К моменту разрушения конкурентный доступ должен быть завершён;
+		// остатки цепочки освобождает деструктор временного списка
+		static_cast<void>(StealAll());
+	}
+
+	// Вставляет элемент в начало за O(1). Lock-free, можно звать из любого потока
+	void PushFront(const Type& value)
+	{
+		PushNode(new Node(nullptr, value));
+	}
+
+	// Вставляет элемент в начало за O(1), перемещая значение в узел
+	void PushFront(Type&& value)
+	{
+		PushNode(new Node(nullptr, std::move(value)));
+	}
+
+	// Конструирует элемент в начале на месте из аргументов args
+	template <typename... Args>
+	void EmplaceFront(Args&&... args)
+	{
+		PushNode(new Node(nullptr, std::forward<Args>(args)...));
+	}
+
+	// Атомарно забирает всю накопленную цепочку и возвращает её обычным SingleLinkedList.
+	// Сам захват — один wait-free exchange за O(1); затем потребитель одним проходом
+	// считает длину и хвост снятой цепочки (её элементы ему в любом случае обходить).
+	// Элементы возвращаются в порядке LIFO — последний вставленный первым
+	[[nodiscard]] List StealAll()
+	{
+		List result;
+		Node* chain = head_.exchange(nullptr, std::memory_order_acquire);
+		if (!chain)
+		{
+			return result;
+		}
+
+		size_t count = 0;
+		Node* last = chain;
+		for (Node* node = chain; node; node = node->next_node)
+		{
+			last = node;
+			++count;
+		}
+		approx_size_.fetch_sub(count, std::memory_order_relaxed);
+
+		result.AdoptChain(chain, last, count);
+		return result;
+	}
+
+	// Сообщает, пуста ли структура в момент вызова (моментальный снимок)
+	[[nodiscard]] bool IsEmpty() const noexcept
+	{
+		return head_.load(std::memory_order_acquire) == nullptr;
+	}
+
+	// Приблизительное количество элементов: может отставать от реального
+	// на элементы, находящиеся «в полёте» между CAS и обновлением счётчика
+	[[nodiscard]] size_t GetSizeApprox() const noexcept
+	{
+		return approx_size_.load(std::memory_order_relaxed);
+	}
+};
@@ -1,6 +1,23 @@
+#include <algorithm>
+#include <atomic>
 #include <cassert>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <thread>
+#include <vector>
 
+#include "compact-single-linked-list.h"
+#include "epoch-reclamation.h"
+#include "indexed-single-linked-list.h"
+#include "list-generator.h"
+#include "lock-free-single-linked-list.h"
+#include "pool-allocator.h"
+#include "shared-single-linked-list.h"
+#include "single-linked-list-view.h"
 #include "single-linked-list.h"
+#include "small-single-linked-list.h"
 
 // Эта функция проверяет работу класса SingleLinkedList
 void Test() {
@@ -112,6 +129,1124 @@ void Test() {
         assert(exception_was_thrown);
     }
 
+    // Сэмплирующая трассировка: при сборке с -DSLL_ENABLE_TRACING горячие операции
+    // попадают в потоколокальный кольцевой буфер, откуда их забирает Drain
+#ifdef SLL_ENABLE_TRACING
+    {
+        // Сбрасываем записи, накопленные предыдущими тестами
+        std::vector<ListTraceEvent> events;
+        DrainListTrace(events);
+        events.clear();
+
+        SingleLinkedList<int> lst;
+        // Сэмпл — 1 к 1024, поэтому операций должно быть заметно больше
+        for (int i = 0; i < 5000; ++i) {
+            lst.InsertAfter(lst.before_begin(), i);
+        }
+        int sum = 0;
+        lst.ForEach([&sum](int value) {
+            sum += value;
+        });
+        assert(sum == 4999 * 5000 / 2);
+        lst.Clear();
+
+        const size_t drained = DrainListTrace(events);
+        assert(drained == events.size());
+        assert(!events.empty());
+        for (const ListTraceEvent& event : events) {
+            assert(event.begin_tsc <= event.end_tsc);
+            assert(event.op == ListTraceOp::kInsertAfter
+                || event.op == ListTraceOp::kEraseAfter
+                || event.op == ListTraceOp::kClear
+                || event.op == ListTraceOp::kCopyConstruct
+                || event.op == ListTraceOp::kTraverse);
+        }
+
+        // Повторный Drain пуст — буфер очищается выгрузкой
+        std::vector<ListTraceEvent> empty_events;
+        assert(DrainListTrace(empty_events) == 0u);
+    }
+#endif
+
+    // constexpr-список: построение и обход вычисляются на этапе компиляции
+#if defined(__cpp_constexpr_dynamic_alloc) && __cpp_constexpr_dynamic_alloc >= 201907L
+    {
+        constexpr int sum = []() constexpr
+        {
+            SingleLinkedList<int> lst;
+            lst.PushFront(3);
+            lst.PushFront(2);
+            lst.PushFront(1);
+            lst.InsertAfter(lst.cbegin(), 10);
+            int result = 0;
+            for (int value : lst)
+            {
+                result += value;
+            }
+            return result;
+        }();
+        static_assert(sum == 16);
+
+        // Сравнения тоже constexpr
+        static_assert(SingleLinkedList<int>{1, 2, 3} == SingleLinkedList<int>{1, 2, 3});
+        static_assert(SingleLinkedList<int>{1, 2} < SingleLinkedList<int>{1, 3});
+
+        // Заморозка построенного на этапе компиляции списка в статический образ
+        static constexpr auto frozen = FreezeListToArray<3>([]()
+        {
+            SingleLinkedList<int> handlers;
+            handlers.PushFront(30);
+            handlers.PushFront(20);
+            handlers.PushFront(10);
+            return handlers;
+        });
+        static_assert(frozen.size() == 3u);
+        static_assert(frozen[0] == 10 && frozen[1] == 20 && frozen[2] == 30);
+    }
+#endif
+
+    // Список со сжатыми 32-битными ссылками: вдвое меньший узел для малых типов
+    {
+        // Слот int-списка — 8 байт против 16 у узла с 64-битным указателем
+        static_assert(CompactSingleLinkedList<int>::kBytesPerNode == 8u);
+
+        CompactSingleLinkedList<int> lst{1, 2, 3};
+        lst.PushFront(0);
+        assert((lst == CompactSingleLinkedList<int>{0, 1, 2, 3}));
+
+        auto pos = lst.InsertAfter(lst.cbegin(), 7);
+        assert(*pos == 7);
+        lst.EraseAfter(lst.before_begin());
+        assert((lst == CompactSingleLinkedList<int>{7, 1, 2, 3}));
+
+        // Слот удалённого элемента переиспользуется без роста пула
+        lst.PopFront();
+        lst.PushFront(9);
+        assert((lst == CompactSingleLinkedList<int>{9, 1, 2, 3}));
+
+        // Итераторы переживают рост пула: индексы не инвалидируются вставками
+        auto it = lst.begin();
+        for (int i = 0; i < 100; ++i)
+        {
+            lst.InsertAfter(lst.cbefore_begin(), i);
+        }
+        assert(*it == 9);
+
+        // Перемещение — O(1), индексы переезжают вместе с пулом
+        CompactSingleLinkedList<int> moved(std::move(lst));
+        assert(moved.GetSize() == 104u);
+        assert(lst.IsEmpty());
+
+        moved.Clear();
+        assert(moved.IsEmpty() && moved.GetSize() == 0u);
+
+        // Копия пересобирает пул плотно и сравнивается поэлементно
+        CompactSingleLinkedList<int> original{5, 6, 7};
+        CompactSingleLinkedList<int> copy(original);
+        copy.PopFront();
+        assert((original == CompactSingleLinkedList<int>{5, 6, 7}));
+        assert((copy == CompactSingleLinkedList<int>{6, 7}));
+        assert(original != copy);
+    }
+
+    // Асинхронная очистка: список пуст сразу, узлы освобождает фоновый поток
+    {
+        static std::atomic<int> destroyed{0};
+        struct AsyncSpy
+        {
+            ~AsyncSpy()
+            {
+                destroyed.fetch_add(1, std::memory_order_relaxed);
+            }
+        };
+
+        SingleLinkedList<AsyncSpy> lst;
+        for (int i = 0; i < 100; ++i)
+        {
+            lst.PushFront(AsyncSpy{});
+        }
+        const int before = destroyed.load();
+
+        lst.ClearAsync();
+        // Вызывающий получает пустой, полностью рабочий список немедленно
+        assert(lst.IsEmpty() && lst.GetSize() == 0u);
+        lst.PushFront(AsyncSpy{});
+        assert(lst.GetSize() == 1u);
+
+        // Flush детерминированно дожидается фоновых деструкторов всех 100
+        // отсоединённых узлов (+1 — временный объект последнего PushFront)
+        ListAsyncReclaimer::Instance().Flush();
+        assert(destroyed.load() == before + 101);
+    }
+
+    // Кеш переработки узлов: удаления кормят последующие вставки без аллокатора
+    {
+        SingleLinkedList<int> lst;
+        for (int i = 0; i < 20; ++i)
+        {
+            lst.PushFront(i);
+        }
+
+        // По умолчанию кеш выключен
+        lst.PopFront();
+        assert(lst.GetNodeCacheSize() == 0u);
+
+        // С пределом 8 кеш наполняется удалениями, но не выше предела
+        lst.SetNodeCacheLimit(8u);
+        for (int i = 0; i < 12; ++i)
+        {
+            lst.PopFront();
+        }
+        assert(lst.GetNodeCacheSize() == 8u);
+        assert(lst.GetSize() == 7u);
+
+        // Вставки разбирают кеш раньше, чем идут к аллокатору
+        lst.PushFront(100);
+        lst.InsertAfter(lst.cbegin(), 200);
+        assert(lst.GetNodeCacheSize() == 6u);
+
+        // Уменьшение предела и ShrinkToFit возвращают блоки аллокатору
+        lst.SetNodeCacheLimit(2u);
+        assert(lst.GetNodeCacheSize() == 2u);
+        lst.ShrinkToFit();
+        assert(lst.GetNodeCacheSize() == 0u);
+
+        // Кеш путешествует вместе с содержимым при swap
+        lst.SetNodeCacheLimit(4u);
+        lst.PopFront();
+        lst.PopFront();
+        SingleLinkedList<int> other;
+        other.swap(lst);
+        assert(other.GetNodeCacheSize() == 2u);
+        assert(lst.GetNodeCacheSize() == 0u);
+    }
+
+    // Ленивые конвейеры на корутинах: один проход, ноль промежуточных списков
+#if defined(__cpp_impl_coroutine) && __has_include(<coroutine>)
+    {
+        SingleLinkedList<int> lst;
+        for (int i = 100; i >= 1; --i)
+        {
+            lst.PushFront(i);
+        }
+
+        // filter -> map -> reduce одним проходом без материализации стадий
+        auto pipeline = Mapped(Filtered(Lazy(lst), [](int value)
+        {
+            return value % 2 == 0;
+        }), [](int value)
+        {
+            return value * 10;
+        });
+        long long sum = 0;
+        size_t produced = 0;
+        for (int value : pipeline)
+        {
+            sum += value;
+            ++produced;
+        }
+        assert(produced == 50u);
+        assert(sum == 10LL * (2 + 100) * 50 / 2);
+
+        // Ленивость: источник продвигается ровно настолько, насколько тянет потребитель
+        size_t pulled = 0;
+        auto counted = Mapped(Lazy(lst), [&pulled](int value)
+        {
+            ++pulled;
+            return value;
+        });
+        auto it = counted.begin();
+        ++it;
+        ++it;
+        assert(pulled == 3u);
+
+        // Пустой список даёт пустой генератор
+        SingleLinkedList<int> empty;
+        auto empty_gen = Lazy(empty);
+        assert(empty_gen.begin() == empty_gen.end());
+    }
+#endif
+
+    // Кешированный дайджест содержимого для быстрого сравнения
+    {
+        using DigestList = SingleLinkedList<int, std::allocator<int>, false, true, true>;
+
+        // PushFront обновляет дайджест инкрементально: он совпадает
+        // с дайджестом списка, построенного любым другим способом
+        DigestList a;
+        a.PushFront(3);
+        a.PushFront(2);
+        a.PushFront(1);
+        DigestList b{1, 2, 3};
+        assert(a.GetDigest() == b.GetDigest());
+        assert(a == b);
+
+        // Мутация в середине помечает дайджест устаревшим, ленивый пересчёт корректен
+        b.InsertAfter(b.cbegin(), 7);
+        assert(a.GetDigest() != b.GetDigest());
+        assert(a != b);
+        b.EraseAfter(b.cbegin());
+        assert(a.GetDigest() == b.GetDigest());
+        assert(a == b);
+
+        // Дайджест порядкозависим
+        DigestList reversed{3, 2, 1};
+        assert(a.GetDigest() != reversed.GetDigest());
+        reversed.Reverse();
+        assert(a.GetDigest() == reversed.GetDigest());
+
+        // Пустые списки равны и имеют нулевой дайджест
+        DigestList empty1;
+        DigestList empty2;
+        assert(empty1.GetDigest() == empty2.GetDigest());
+        a.Clear();
+        assert(a.GetDigest() == empty1.GetDigest());
+    }
+
+    // Параллельный обход по сегментам цепочки
+    {
+        SingleLinkedList<int> lst;
+        long long expected_sum = 0;
+        for (int i = 1000; i >= 1; --i)
+        {
+            lst.PushFront(i);
+            expected_sum += i;
+        }
+
+        // Сумма, набранная четырьмя потоками, совпадает с последовательной
+        std::atomic<long long> sum{0};
+        lst.ParallelForEach([&sum](const int& value)
+        {
+            sum.fetch_add(value, std::memory_order_relaxed);
+        }, 4u);
+        assert(sum.load() == expected_sum);
+
+        // Преобразование на месте: сегменты не пересекаются, порядок сохраняется
+        lst.ParallelTransform([](int value)
+        {
+            return value * 2;
+        }, 4u);
+        int expected = 2;
+        for (int value : lst)
+        {
+            assert(value == expected);
+            expected += 2;
+        }
+
+        // Потоков больше, чем элементов, и ноль потоков — корректные вырожденные случаи
+        SingleLinkedList<int> tiny{1, 2, 3};
+        std::atomic<int> tiny_sum{0};
+        tiny.ParallelForEach([&tiny_sum](const int& value)
+        {
+            tiny_sum.fetch_add(value);
+        }, 16u);
+        assert(tiny_sum.load() == 6);
+        tiny.ParallelForEach([&tiny_sum](const int& value)
+        {
+            tiny_sum.fetch_add(value);
+        }, 0u);
+        assert(tiny_sum.load() == 12);
+    }
+
+    // Политика проверок Checked: непроверяемый вариант работает идентично
+    {
+        using UncheckedList = SingleLinkedList<int, std::allocator<int>, false, false>;
+        UncheckedList lst{1, 2, 3};
+        lst.PushFront(0);
+        lst.InsertAfter(lst.cbegin(), 5);
+        lst.EraseAfter(lst.cbegin());
+        lst.PopFront();
+        assert((lst == UncheckedList{1, 2, 3}));
+        int sum = 0;
+        for (int value : lst)
+        {
+            sum += value;
+        }
+        assert(sum == 6);
+
+        // Проверяемый вариант (по умолчанию) по-прежнему бросает на нулевом итераторе
+        bool thrown = false;
+        try
+        {
+            SingleLinkedList<int> checked;
+            checked.InsertAfter(SingleLinkedList<int>::ConstIterator{}, 1);
+        }
+        catch (const std::invalid_argument&)
+        {
+            thrown = true;
+        }
+        assert(thrown);
+    }
+
+    // Список с малым встроенным буфером: короткие списки живут без кучи
+    {
+        SmallSingleLinkedList<int, 3> lst;
+        lst.PushFront(3);
+        lst.PushFront(2);
+        lst.PushFront(1);
+        // Три элемента умещаются во встроенном буфере
+        assert(lst.IsFullyInline());
+        assert((lst == SmallSingleLinkedList<int, 3>{1, 2, 3}));
+
+        // Четвёртый элемент уходит в кучу
+        lst.InsertAfter(lst.before_begin(), 0);
+        assert(!lst.IsFullyInline());
+        assert(lst.GetSize() == 4u);
+
+        // После удаления встроенная ячейка переиспользуется
+        lst.PopFront();
+        lst.EraseAfter(lst.cbegin());
+        assert(lst.GetSize() == 2u);
+        lst.PushFront(7);
+        assert((lst == SmallSingleLinkedList<int, 3>{7, 1, 3}));
+
+        // Перемещение и swap переносят элементы корректно при любом разбиении
+        // инлайн/куча (в т.ч. когда часть узлов в буфере, часть в куче)
+        SmallSingleLinkedList<int, 2> mixed{1, 2, 3, 4};
+        SmallSingleLinkedList<int, 2> moved(std::move(mixed));
+        assert((moved == SmallSingleLinkedList<int, 2>{1, 2, 3, 4}));
+        assert(mixed.IsEmpty() && mixed.IsFullyInline());
+
+        SmallSingleLinkedList<int, 2> a{1, 2, 3};
+        SmallSingleLinkedList<int, 2> b{9};
+        swap(a, b);
+        assert((a == SmallSingleLinkedList<int, 2>{9}));
+        assert((b == SmallSingleLinkedList<int, 2>{1, 2, 3}));
+        assert(a.IsFullyInline());
+
+        // Пустой и очищенный списки не держат кучных узлов
+        b.Clear();
+        assert(b.IsEmpty() && b.IsFullyInline());
+    }
+
+    // Слой статистики: счётчики операций и аллокаций при EnableStats = true
+    {
+        // Включённый слой добавляет к списку ровно счётчики ListStats;
+        // выключенный — пустая база, не занимающая ни байта
+        static_assert(sizeof(SingleLinkedList<int, std::allocator<int>, true>)
+            == sizeof(SingleLinkedList<int>) + sizeof(ListStats));
+
+        SingleLinkedList<int, std::allocator<int>, true> lst;
+        lst.PushFront(1);
+        lst.PushBack(2);
+        lst.InsertAfter(lst.cbegin(), 3);
+        lst.EmplaceFront(0);
+        auto stats = lst.GetStats();
+        assert(stats.push_front_calls == 2u);
+        assert(stats.push_back_calls == 1u);
+        assert(stats.insert_after_calls == 1u);
+        assert(stats.nodes_allocated == 4u);
+        assert(stats.nodes_deallocated == 0u);
+        assert(stats.peak_size == 4u);
+        assert(stats.bytes_held > 4u * sizeof(int));
+
+        lst.PopFront();
+        lst.EraseAfter(lst.cbegin());
+        stats = lst.GetStats();
+        assert(stats.pop_front_calls == 1u);
+        assert(stats.erase_after_calls == 1u);
+        assert(stats.nodes_deallocated == 2u);
+        // Пик не уменьшается при удалениях
+        assert(stats.peak_size == 4u && lst.GetSize() == 2u);
+
+        // Счётчики обмениваются вместе с содержимым
+        SingleLinkedList<int, std::allocator<int>, true> other;
+        other.swap(lst);
+        assert(other.GetStats().nodes_allocated == 4u);
+        assert(lst.GetStats().nodes_allocated == 0u);
+        assert((other == SingleLinkedList<int, std::allocator<int>, true>{1, 2}));
+
+        // Сравнения порядка доступны и для списков с не-дефолтными policy-параметрами
+        assert(other >= other);
+        assert(!(other > other));
+        assert((other > SingleLinkedList<int, std::allocator<int>, true>{1}));
+        assert(!(SingleLinkedList<int, std::allocator<int>, true>{2}
+            <= SingleLinkedList<int, std::allocator<int>, true>{1}));
+    }
+
+    // Список с хеш-индексом: принадлежность за O(1)
+    {
+        IndexedSingleLinkedList<int> lst{1, 2, 3};
+        assert(lst.Contains(2));
+        assert(!lst.Contains(42));
+        assert(*lst.FindNode(3) == 3);
+
+        // Индекс синхронен со вставками и удалениями
+        lst.PushFront(0);
+        lst.InsertAfter(lst.cbegin(), 5);
+        assert(lst.Contains(0) && lst.Contains(5));
+        lst.PopFront();
+        assert(!lst.Contains(0));
+        lst.EraseAfter(lst.cbegin());
+        assert(!lst.Contains(1));
+        assert(lst.GetSize() == 3u);
+
+        // Дубликаты: удаление одного вхождения не теряет остальные
+        lst.PushFront(2);
+        lst.PopFront();
+        assert(lst.Contains(2));
+
+        // Индекс выдерживает рост далеко за стартовую ёмкость
+        IndexedSingleLinkedList<int> big;
+        for (int i = 0; i < 1000; ++i)
+        {
+            big.PushFront(i);
+        }
+        for (int i = 0; i < 1000; ++i)
+        {
+            assert(big.Contains(i));
+        }
+        assert(!big.Contains(1000));
+
+        // Копия строит собственный индекс
+        IndexedSingleLinkedList<int> copy(lst);
+        copy.PopFront();
+        assert(lst.Contains(*lst.begin()));
+
+        lst.Clear();
+        assert(lst.IsEmpty());
+        assert(!lst.Contains(2));
+    }
+
+    // Copy-on-write список со структурным разделением узлов
+    {
+        SharedSingleLinkedList<int> original{1, 2, 3, 4};
+        // Снимок за O(1): узлы разделяются, а не копируются
+        SharedSingleLinkedList<int> snapshot(original);
+        assert(snapshot == original);
+
+        // PushFront на снимке не трогает оригинал и не копирует хвост
+        snapshot.PushFront(0);
+        assert((snapshot == SharedSingleLinkedList<int>{0, 1, 2, 3, 4}));
+        assert((original == SharedSingleLinkedList<int>{1, 2, 3, 4}));
+
+        // Деструктивная операция копирует только префикс до места изменения
+        SharedSingleLinkedList<int> edited(original);
+        edited.EraseAfter(edited.begin());
+        assert((edited == SharedSingleLinkedList<int>{1, 3, 4}));
+        assert((original == SharedSingleLinkedList<int>{1, 2, 3, 4}));
+
+        auto inserted = edited.InsertAfter(++edited.begin(), 99);
+        assert(*inserted == 99);
+        assert((edited == SharedSingleLinkedList<int>{1, 3, 99, 4}));
+        assert((original == SharedSingleLinkedList<int>{1, 2, 3, 4}));
+
+        // PopFront на разделяемом списке также O(1)
+        SharedSingleLinkedList<int> popped(original);
+        popped.PopFront();
+        assert((popped == SharedSingleLinkedList<int>{2, 3, 4}));
+        assert(original.GetSize() == 4u);
+    }
+
+#if defined(__unix__) || defined(__APPLE__)
+    // mmap-представление снапшота со смещениями вместо указателей
+    {
+        SingleLinkedList<int> source;
+        for (int i = 1000; i > 0; --i)
+        {
+            source.PushFront(i);
+        }
+
+        const char* path = "/tmp/single-linked-list-snapshot-test.bin";
+        {
+            std::ofstream file(path, std::ios::binary | std::ios::trunc);
+            SingleLinkedListView<int>::WriteSnapshot(source, file);
+        }
+
+        SingleLinkedListView<int> view(path);
+        assert(view.GetSize() == source.GetSize());
+        assert(!view.IsEmpty());
+        assert(std::equal(view.begin(), view.end(), source.begin(), source.end()));
+
+        // Тот же интерфейс forward-итератора, что и у SingleLinkedList
+        long long sum = 0;
+        for (int value : view)
+        {
+            sum += value;
+        }
+        assert(sum == 1000LL * 1001 / 2);
+
+        // Пустой снапшот
+        {
+            std::ofstream file(path, std::ios::binary | std::ios::trunc);
+            SingleLinkedListView<int>::WriteSnapshot(SingleLinkedList<int>{}, file);
+        }
+        SingleLinkedListView<int> empty_view(path);
+        assert(empty_view.IsEmpty());
+        assert(empty_view.begin() == empty_view.end());
+
+        // Испорченный заголовок с гигантским count не обходит проверку размера
+        // через переполнение умножения
+        {
+            std::ofstream file(path, std::ios::binary | std::ios::trunc);
+            const uint64_t huge_count = ~uint64_t{0} / 8u;
+            file.write(reinterpret_cast<const char*>(&huge_count), sizeof(huge_count));
+        }
+        try {
+            SingleLinkedListView<int> corrupt_view(path);
+            assert(false);
+        } catch (const std::runtime_error&) {
+        }
+
+        // Смещение next_offset за пределами отображения обнаруживается при обходе
+        {
+            std::ofstream file(path, std::ios::binary | std::ios::trunc);
+            SingleLinkedListView<int>::WriteSnapshot(SingleLinkedList<int>{1, 2}, file);
+        }
+        {
+            std::fstream file(path, std::ios::binary | std::ios::in | std::ios::out);
+            // next_offset первой записи лежит сразу после её значения (int + паддинг)
+            file.seekp(sizeof(uint64_t) + sizeof(uint64_t));
+            const uint64_t bad_offset = 1u << 20;
+            file.write(reinterpret_cast<const char*>(&bad_offset), sizeof(bad_offset));
+        }
+        SingleLinkedListView<int> bad_links_view(path);
+        try {
+            auto it = bad_links_view.begin();
+            ++it;
+            assert(false);
+        } catch (const std::runtime_error&) {
+        }
+
+        std::remove(path);
+    }
+#endif
+
+    // Бинарная сериализация с префиксом размера
+    {
+        SingleLinkedList<int> source;
+        for (int i = 5000; i > 0; --i)
+        {
+            source.PushFront(i);
+        }
+
+        std::stringstream stream;
+        source.Serialize(stream);
+
+        SingleLinkedList<int> restored{-1, -2};
+        restored.Deserialize(stream);
+        assert(restored == source);
+        assert(restored.GetSize() == 5000u);
+
+        // Пустой список тоже сериализуется
+        std::stringstream empty_stream;
+        SingleLinkedList<int>{}.Serialize(empty_stream);
+        SingleLinkedList<int> empty_restored{1};
+        empty_restored.Deserialize(empty_stream);
+        assert(empty_restored.IsEmpty());
+
+        // Усечённый поток не портит список-приёмник
+        std::stringstream truncated;
+        source.Serialize(truncated);
+        std::string data = truncated.str();
+        data.resize(data.size() / 2);
+        std::stringstream half(data);
+        SingleLinkedList<int> keeper{7, 8, 9};
+        bool thrown = false;
+        try {
+            keeper.Deserialize(half);
+        } catch (const std::runtime_error&) {
+            thrown = true;
+        }
+        assert(thrown);
+        assert((keeper == SingleLinkedList<int>{7, 8, 9}));
+    }
+
+    // Поиск, подсчёт и свёртка
+    {
+        SingleLinkedList<int> lst{3, 1, 4, 1, 5, 9, 2, 6};
+        assert(*lst.Find(4) == 4);
+        assert(lst.Find(100) == lst.end());
+        assert(lst.Count(1) == 2u);
+        assert(lst.Accumulate(0, [](int acc, int value) { return acc + value; }) == 31);
+
+        // Найденный элемент можно менять через итератор
+        *lst.Find(9) = 10;
+        assert(lst.Count(10) == 1u);
+
+        // Чанковая раскладка: те же операции по непрерывным массивам
+        UnrolledLinkedList<int, 4> unrolled{3, 1, 4, 1, 5, 9, 2, 6, 5, 3};
+        assert(*unrolled.Find(9) == 9);
+        assert(unrolled.Find(100) == unrolled.end());
+        assert(unrolled.Count(5) == 2u);
+        assert(unrolled.Count(3) == 2u);
+        assert(unrolled.Accumulate(0LL, [](long long acc, int value) { return acc + value; }) == 39);
+    }
+
+    // Обход с программным префетчем
+    {
+        SingleLinkedList<int> lst;
+        for (int i = 100; i > 0; --i)
+        {
+            lst.PushFront(i);
+        }
+
+        long long sum = 0;
+        lst.ForEach([&sum](int value) { sum += value; });
+        assert(sum == 5050);
+
+        // Неконстантная версия может модифицировать элементы
+        lst.ForEach([](int& value) { value *= 2; });
+        assert(*lst.begin() == 2);
+
+        long long batch_sum = 0;
+        const auto& const_lst = lst;
+        const_lst.ForEachBatch([&batch_sum](int value) { batch_sum += value; }, 16);
+        assert(batch_sum == 2 * 5050);
+
+        // Дистанция префетча больше длины списка не ломает обход
+        SingleLinkedList<int> tiny{1, 2};
+        int count = 0;
+        tiny.ForEach([&count](int) { ++count; }, 100);
+        assert(count == 2);
+    }
+
+    // Эпохальное отложенное освобождение: удаление при живых читателях
+    {
+        EpochReclamationDomain domain;
+        SingleLinkedList<int> lst{1, 2, 3, 4, 5};
+
+        std::atomic<bool> readers_may_finish{false};
+        std::atomic<long long> read_sum{0};
+        std::vector<std::thread> readers;
+        for (int r = 0; r < 2; ++r)
+        {
+            readers.emplace_back([&] {
+                // Каждый обход целиком выполняется под ReadGuard
+                while (!readers_may_finish.load())
+                {
+                    auto guard = domain.EnterRead();
+                    long long local = 0;
+                    for (int value : lst)
+                    {
+                        local += value;
+                    }
+                    read_sum.fetch_add(local);
+                }
+            });
+        }
+
+        // Писатель вышивает узлы; их физическое удаление откладывается доменом
+        lst.EraseAfterDeferred(lst.cbegin(), domain);
+        lst.EraseAfterDeferred(lst.cbegin(), domain);
+        assert((lst == SingleLinkedList<int>{1, 4, 5}));
+
+        readers_may_finish.store(true);
+        for (auto& reader : readers)
+        {
+            reader.join();
+        }
+
+        // После выхода читателей несколько попыток сборки освобождают всех пенсионеров
+        domain.Collect();
+        domain.Collect();
+        domain.Collect();
+        assert(domain.GetRetiredCount() == 0u);
+
+        // Индексы слотов переиспользуются после завершения потоков:
+        // ротация короткоживущих потоков (как в пуле) не исчерпывает лимит
+        for (int wave = 0; wave < 200; ++wave)
+        {
+            std::thread short_lived([&] {
+                auto guard = domain.EnterRead();
+            });
+            short_lived.join();
+        }
+    }
+
+    // Lock-free список: CAS-вставка из нескольких потоков и StealAll
+    {
+        // Однопоточная проверка семантики: StealAll отдаёт элементы в порядке LIFO
+        LockFreeSingleLinkedList<int> lf;
+        lf.PushFront(1);
+        lf.PushFront(2);
+        lf.EmplaceFront(3);
+        assert(lf.GetSizeApprox() == 3u);
+        SingleLinkedList<int> stolen = lf.StealAll();
+        assert((stolen == SingleLinkedList<int>{3, 2, 1}));
+        assert(lf.IsEmpty());
+        // Украденная цепочка — полноценный список: хвост и размер корректны
+        stolen.PushBack(0);
+        assert((stolen == SingleLinkedList<int>{3, 2, 1, 0}));
+
+        // Многопоточная проверка: несколько писателей, один потребитель
+        LockFreeSingleLinkedList<int> queue;
+        constexpr int kProducers = 4;
+        constexpr int kPerProducer = 10000;
+        std::vector<std::thread> producers;
+        for (int p = 0; p < kProducers; ++p)
+        {
+            producers.emplace_back([&queue, p] {
+                for (int i = 0; i < kPerProducer; ++i)
+                {
+                    queue.PushFront(p * kPerProducer + i);
+                }
+            });
+        }
+        size_t total = 0;
+        long long sum = 0;
+        while (total < static_cast<size_t>(kProducers) * kPerProducer)
+        {
+            SingleLinkedList<int> batch = queue.StealAll();
+            total += batch.GetSize();
+            for (int value : batch)
+            {
+                sum += value;
+            }
+        }
+        for (auto& producer : producers)
+        {
+            producer.join();
+        }
+        const long long n = static_cast<long long>(kProducers) * kPerProducer;
+        assert(total == static_cast<size_t>(n));
+        assert(sum == n * (n - 1) / 2);
+        assert(queue.IsEmpty());
+    }
+
+    // Сортировка, слияние и разворот на месте
+    {
+        SingleLinkedList<int> lst{5, 3, 1, 4, 2, 8, 7, 6};
+        lst.Sort();
+        assert((lst == SingleLinkedList<int>{1, 2, 3, 4, 5, 6, 7, 8}));
+        // Хвост актуален после перешивки узлов сортировкой
+        lst.PushBack(9);
+        assert((lst == SingleLinkedList<int>{1, 2, 3, 4, 5, 6, 7, 8, 9}));
+
+        SingleLinkedList<int> descending{2, 9, 4};
+        descending.Sort([](int lhs, int rhs) { return lhs > rhs; });
+        assert((descending == SingleLinkedList<int>{9, 4, 2}));
+
+        SingleLinkedList<int> merged{1, 3, 5};
+        merged.Merge(SingleLinkedList<int>{2, 4, 6, 7});
+        assert((merged == SingleLinkedList<int>{1, 2, 3, 4, 5, 6, 7}));
+        merged.PushBack(8);
+        assert(merged.GetSize() == 8u);
+
+        SingleLinkedList<int> reversed{1, 2, 3};
+        reversed.Reverse();
+        assert((reversed == SingleLinkedList<int>{3, 2, 1}));
+        reversed.PushBack(0);
+        assert((reversed == SingleLinkedList<int>{3, 2, 1, 0}));
+
+        // Вырожденные случаи: пустой и одноэлементный списки
+        SingleLinkedList<int> empty;
+        empty.Sort();
+        empty.Reverse();
+        assert(empty.IsEmpty());
+        SingleLinkedList<int> single{42};
+        single.Sort();
+        single.Reverse();
+        assert((single == SingleLinkedList<int>{42}));
+    }
+
+    // Счётные диапазонные операции: размер обоих списков обновляется за O(1)
+    {
+        SingleLinkedList<int> lst{1, 2, 3, 4, 5};
+        // Отделяем (begin, end) без двух последних границ: узлы 2, 3, 4
+        auto extracted = lst.ExtractAfter(lst.cbegin(), ++(++(++(++lst.cbegin()))), 3);
+        assert((extracted == SingleLinkedList<int>{2, 3, 4}));
+        assert((lst == SingleLinkedList<int>{1, 5}));
+        assert(extracted.GetSize() == 3u);
+        assert(lst.GetSize() == 2u);
+        // Отделённая цепочка — полноценный список с корректным хвостом
+        extracted.PushBack(6);
+        assert((extracted == SingleLinkedList<int>{2, 3, 4, 6}));
+
+        // Счётный SpliceAfter переносит диапазон без пересчёта
+        SingleLinkedList<int> target{10, 20};
+        target.SpliceAfter(target.cbegin(), extracted, extracted.cbefore_begin(), ++(++extracted.cbegin()), 2);
+        assert((target == SingleLinkedList<int>{10, 2, 3, 20}));
+        assert((extracted == SingleLinkedList<int>{4, 6}));
+        assert(target.GetSize() == 4u);
+        assert(extracted.GetSize() == 2u);
+
+        // Извлечение хвостового диапазона обновляет tail_ источника
+        auto tail_part = lst.ExtractAfter(lst.cbegin(), lst.cend(), 1);
+        assert((tail_part == SingleLinkedList<int>{5}));
+        lst.PushBack(7);
+        assert((lst == SingleLinkedList<int>{1, 7}));
+
+        // Нулевой count — пустой результат без изменений
+        auto nothing = lst.ExtractAfter(lst.cbegin(), lst.cbegin(), 0);
+        assert(nothing.IsEmpty());
+        assert(lst.GetSize() == 2u);
+    }
+
+    // Удаление по значению, по предикату и дедупликация на месте
+    {
+        SingleLinkedList<int> lst{1, 2, 1, 3, 1, 4};
+        assert(lst.Remove(1) == 3u);
+        assert((lst == SingleLinkedList<int>{2, 3, 4}));
+        assert(lst.GetSize() == 3u);
+
+        assert(lst.RemoveIf([](int value) { return value % 2 == 0; }) == 2u);
+        assert((lst == SingleLinkedList<int>{3}));
+        // Хвост актуален после удаления последних элементов
+        lst.PushBack(5);
+        assert((lst == SingleLinkedList<int>{3, 5}));
+
+        SingleLinkedList<int> dupes{1, 1, 2, 2, 2, 3, 1, 1};
+        assert(dupes.Unique() == 4u);
+        assert((dupes == SingleLinkedList<int>{1, 2, 3, 1}));
+        dupes.PushBack(9);
+        assert((dupes == SingleLinkedList<int>{1, 2, 3, 1, 9}));
+
+        // Удаление всех элементов оставляет корректный пустой список
+        SingleLinkedList<int> all{7, 7};
+        assert(all.Remove(7) == 2u);
+        assert(all.IsEmpty());
+        all.PushBack(1);
+        assert((all == SingleLinkedList<int>{1}));
+
+        // Исключение из предиката посреди прохода не рассогласует размер:
+        // уже удалённые узлы не числятся в GetSize()
+        SingleLinkedList<int> partial{2, 4, 1, 6};
+        try {
+            partial.RemoveIf([](int value) {
+                if (value == 1) {
+                    throw std::runtime_error("предикат отказал"s);
+                }
+                return value % 2 == 0;
+            });
+            assert(false);
+        } catch (const std::runtime_error&) {
+            assert((partial == SingleLinkedList<int>{1, 6}));
+            assert(partial.GetSize() == 2u);
+        }
+    }
+
+    // Перешивка узлов между списками без копирования значений
+    {
+        // Перенос целого списка за O(1)
+        SingleLinkedList<int> target{1, 5};
+        SingleLinkedList<int> donor{2, 3, 4};
+        target.SpliceAfter(target.cbegin(), std::move(donor));
+        assert((target == SingleLinkedList<int>{1, 2, 3, 4, 5}));
+        assert(donor.IsEmpty());
+
+        // Перенос одного узла
+        SingleLinkedList<int> src{10, 20, 30};
+        target.SpliceAfter(target.cbefore_begin(), src, src.cbegin());
+        assert((target == SingleLinkedList<int>{20, 1, 2, 3, 4, 5}));
+        assert((src == SingleLinkedList<int>{10, 30}));
+
+        // Перенос диапазона (first, last): границы в диапазон не входят
+        SingleLinkedList<int> range_donor{100, 200, 300, 400};
+        target.SpliceAfter(target.cbegin(), range_donor, range_donor.cbegin(), range_donor.cend());
+        assert((target == SingleLinkedList<int>{20, 200, 300, 400, 1, 2, 3, 4, 5}));
+        assert((range_donor == SingleLinkedList<int>{100}));
+
+        // Хвост принимающего списка корректен после вставки в конец
+        SingleLinkedList<int> tail_check{1};
+        SingleLinkedList<int> tail_donor{2, 3};
+        tail_check.SpliceAfter(tail_check.cbegin(), std::move(tail_donor));
+        tail_check.PushBack(4);
+        assert((tail_check == SingleLinkedList<int>{1, 2, 3, 4}));
+    }
+
+    // Конструктор из диапазона и массовые вставки
+    {
+        const std::vector<int> source{1, 2, 3, 4, 5};
+        SingleLinkedList<int> lst(source.begin(), source.end());
+        assert((lst == SingleLinkedList<int>{1, 2, 3, 4, 5}));
+
+        const std::vector<int> replacement{7, 8};
+        lst.AssignRange(replacement.begin(), replacement.end());
+        assert((lst == SingleLinkedList<int>{7, 8}));
+
+        const std::vector<int> middle{10, 11, 12};
+        const auto last_inserted = lst.InsertRangeAfter(lst.cbegin(), middle.begin(), middle.end());
+        assert((lst == SingleLinkedList<int>{7, 10, 11, 12, 8}));
+        assert(*last_inserted == 12);
+
+        // Пустой диапазон не меняет список, вставка в хвост обновляет его
+        lst.InsertRangeAfter(lst.cbegin(), middle.begin(), middle.begin());
+        assert(lst.GetSize() == 5u);
+        lst.InsertRangeAfter(++(++(++(++lst.cbegin()))), replacement.begin(), replacement.end());
+        lst.PushBack(9);
+        assert((lst == SingleLinkedList<int>{7, 10, 11, 12, 8, 7, 8, 9}));
+    }
+
+    // Развёрнутый список: элементы хранятся блоками внутри чанков
+    {
+        UnrolledLinkedList<int, 4> lst{1, 2, 3, 4, 5, 6};
+        assert(lst.GetSize() == 6u);
+        assert((lst == UnrolledLinkedList<int, 4>{1, 2, 3, 4, 5, 6}));
+
+        // Обход пересекает границу чанков (ёмкость 4) прозрачно для итератора
+        int expected = 1;
+        for (int value : lst)
+        {
+            assert(value == expected);
+            ++expected;
+        }
+
+        // PushFront сдвигает элементы внутри головного чанка либо создаёт новый чанк
+        UnrolledLinkedList<int, 2> front_lst;
+        front_lst.PushFront(3);
+        front_lst.PushFront(2);
+        front_lst.PushFront(1);
+        assert((front_lst == UnrolledLinkedList<int, 2>{1, 2, 3}));
+
+        // Копирование и перемещение
+        UnrolledLinkedList<int, 4> copy(lst);
+        assert(copy == lst);
+        UnrolledLinkedList<int, 4> moved(std::move(copy));
+        assert(moved == lst);
+        assert(copy.IsEmpty());
+
+        lst.Clear();
+        assert(lst.IsEmpty());
+    }
+
+    // PushBack и Append за O(1) через кешированный хвост
+    {
+        SingleLinkedList<int> lst;
+        lst.PushBack(1);
+        lst.PushBack(2);
+        lst.EmplaceBack(3);
+        assert((lst == SingleLinkedList<int>{1, 2, 3}));
+
+        // Хвост корректно поддерживается при вставках и удалениях
+        lst.PushFront(0);
+        lst.InsertAfter(++(++(++lst.cbegin())), 4);
+        assert((lst == SingleLinkedList<int>{0, 1, 2, 3, 4}));
+        lst.EraseAfter(++(++(++lst.cbegin())));
+        lst.PushBack(5);
+        assert((lst == SingleLinkedList<int>{0, 1, 2, 3, 5}));
+
+        SingleLinkedList<int> other{6, 7};
+        lst.Append(std::move(other));
+        assert((lst == SingleLinkedList<int>{0, 1, 2, 3, 5, 6, 7}));
+        assert(other.IsEmpty());
+        lst.PushBack(8);
+        assert(*(++(++(++(++(++(++(++lst.begin()))))))) == 8);
+
+        // После PopFront последнего элемента хвост сбрасывается
+        SingleLinkedList<int> single;
+        single.PushBack(42);
+        single.PopFront();
+        assert(single.IsEmpty());
+        single.PushBack(43);
+        assert((single == SingleLinkedList<int>{43}));
+    }
+
+    // Перемещающие вставки и emplace-методы
+    {
+        // Тип, который можно перемещать, но нельзя копировать
+        struct MoveOnly {
+            explicit MoveOnly(int v) : value(v) {}
+            MoveOnly(MoveOnly&&) = default;
+            MoveOnly& operator=(MoveOnly&&) = default;
+            MoveOnly(const MoveOnly&) = delete;
+            MoveOnly() = default;
+            int value = 0;
+        };
+
+        SingleLinkedList<MoveOnly> lst;
+        lst.PushFront(MoveOnly(1));
+        auto& emplaced = lst.EmplaceFront(2);
+        assert(emplaced.value == 2);
+        lst.InsertAfter(lst.cbegin(), MoveOnly(3));
+        auto pos = lst.EmplaceAfter(lst.cbegin(), 4);
+        assert(pos->value == 4);
+        assert(lst.GetSize() == 4u);
+        assert(lst.begin()->value == 2);
+    }
+
+    // Перемещающий конструктор и перемещающее присваивание
+    {
+        SingleLinkedList<int> source{1, 2, 3, 4};
+        SingleLinkedList<int> moved(std::move(source));
+        assert((moved == SingleLinkedList<int>{1, 2, 3, 4}));
+        assert(source.IsEmpty());
+
+        SingleLinkedList<int> target{9, 9};
+        target = std::move(moved);
+        assert((target == SingleLinkedList<int>{1, 2, 3, 4}));
+        assert(moved.IsEmpty());
+
+        // Перемещение не копирует элементы, поэтому допустимо и для некопируемых нагрузок
+        SingleLinkedList<DeletionSpy> spies;
+        int deletion_counter = 0;
+        spies.PushFront(DeletionSpy{});
+        spies.begin()->deletion_counter_ptr = &deletion_counter;
+        SingleLinkedList<DeletionSpy> moved_spies(std::move(spies));
+        assert(deletion_counter == 0);
+        assert(moved_spies.GetSize() == 1u);
+    }
+
+    // Работа списка поверх пул-аллокатора
+    {
+        SingleLinkedList<int, PoolAllocator<int>> numbers{1, 2, 3, 4};
+        assert((numbers == SingleLinkedList<int, PoolAllocator<int>>{1, 2, 3, 4}));
+        numbers.PushFront(0);
+        numbers.PopFront();
+        numbers.InsertAfter(numbers.cbegin(), 42);
+        assert(numbers.GetSize() == 5u);
+        // Тривиально разрушаемый тип + PoolAllocator: Clear отдаёт узлы пулу за O(1)
+        numbers.Clear();
+        assert(numbers.IsEmpty());
+        // Пул переиспользует освобождённые блоки
+        numbers.PushFront(7);
+        assert(*numbers.begin() == 7);
+
+        // Rebind-копии разделяют пул и сравниваются равными с оригиналом,
+        // поэтому между списками с одним аллокатором возможен перенос узлов
+        PoolAllocator<int> shared_alloc;
+        assert((PoolAllocator<long long>(shared_alloc) == shared_alloc));
+        SingleLinkedList<int, PoolAllocator<int>> destination(shared_alloc);
+        SingleLinkedList<int, PoolAllocator<int>> source(shared_alloc);
+        destination.PushFront(1);
+        source.PushFront(2);
+        destination.Append(std::move(source));
+        assert((destination == SingleLinkedList<int, PoolAllocator<int>>{1, 2}));
+        assert(source.IsEmpty());
+
+        // Вставка диапазона строит цепочку на аллокаторе узлов самого списка:
+        // вшитые узлы живут в пуле списка, а не во временном пуле
+        std::vector<int> range_values{2, 3, 4};
+        SingleLinkedList<int, PoolAllocator<int>> ranged{1, 5};
+        ranged.InsertRangeAfter(ranged.cbegin(), range_values.begin(), range_values.end());
+        assert((ranged == SingleLinkedList<int, PoolAllocator<int>>{1, 2, 3, 4, 5}));
+
+        // Извлечённый диапазон несёт аллокатор источника, поэтому остаётся
+        // работоспособным (и корректно освобождает узлы) пережив источник
+        SingleLinkedList<int, PoolAllocator<int>> extracted = [] {
+            SingleLinkedList<int, PoolAllocator<int>> extract_source{1, 2, 3, 4, 5};
+            return extract_source.ExtractAfter(extract_source.cbegin(), extract_source.cend(), 4u);
+        }();
+        assert((extracted == SingleLinkedList<int, PoolAllocator<int>>{2, 3, 4, 5}));
+
+        // Быстрая очистка через ReleaseAll выполняется только единоличным
+        // владельцем пула: разрушение копии (она разделяет пул оригинала)
+        // не сбрасывает подпул под живыми узлами оригинала
+        PoolAllocator<int> owner_alloc;
+        SingleLinkedList<int, PoolAllocator<int>> original_list(owner_alloc);
+        original_list.PushFront(111);
+        original_list.PushFront(222);
+        {
+            SingleLinkedList<int, PoolAllocator<int>> doomed_copy(original_list);
+            assert((doomed_copy == original_list));
+        }
+        SingleLinkedList<int, PoolAllocator<int>> clobber(owner_alloc);
+        clobber.PushFront(888);
+        clobber.PushFront(999);
+        assert((original_list == SingleLinkedList<int, PoolAllocator<int>>{222, 111}));
+
+        // Счётная перешивка диапазона между списками с общим пулом
+        SingleLinkedList<int, PoolAllocator<int>> splice_target(shared_alloc);
+        SingleLinkedList<int, PoolAllocator<int>> splice_donor(shared_alloc);
+        splice_target.PushFront(9);
+        splice_donor.PushBack(7);
+        splice_donor.PushBack(8);
+        splice_target.SpliceAfter(splice_target.cbegin(), splice_donor,
+            splice_donor.cbefore_begin(), splice_donor.cend(), 2u);
+        assert((splice_target == SingleLinkedList<int, PoolAllocator<int>>{9, 7, 8}));
+        assert(splice_donor.IsEmpty());
+    }
+
     // Удаление элементов после указанной позиции
     {
         {
@@ -0,0 +1,186 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <vector>
+
+// Состояние пул-аллокатора, разделяемое всеми его копиями и rebind-копиями.
+// Выносится из шаблона: у PoolAllocator<T> и PoolAllocator<U> должен быть
+// один и тот же тип пула, иначе rebind-копия не сможет разделить пул оригинала.
+// Куски группируются по размеру блока: каждая инстанциация аллокатора работает
+// со своим подпулом внутри общего состояния. Подпулов единицы (тип элемента
+// и тип узла), поэтому линейного поиска достаточно
+struct PoolAllocatorPool
+{
+	// Количество блоков в одном куске. Первый кусок выделяется при первом запросе
+	static constexpr size_t kBlocksPerChunk = 1024u;
+
+	// Подпул блоков одного размера
+	struct SubPool
+	{
+		// Размер одного блока подпула
+		size_t block_size = 0;
+		// Выделенные куски памяти
+		std::vector<std::unique_ptr<unsigned char[]>> chunks;
+		// Индекс куска, из которого идёт линейная раздача блоков
+		size_t current_chunk = 0;
+		// Количество уже розданных блоков в текущем куске
+		size_t used_in_current = 0;
+		// Односвязный список блоков, возвращённых через deallocate
+		void* free_list = nullptr;
+
+		void* Allocate()
+		{
+			// Сначала пробуем переиспользовать освобождённый блок
+			if (free_list)
+			{
+				void* block = free_list;
+				free_list = *static_cast<void**>(block);
+				return block;
+			}
+			// Затем — линейная раздача из текущего куска
+			if (current_chunk == chunks.size() || used_in_current == kBlocksPerChunk)
+			{
+				if (current_chunk + 1 < chunks.size())
+				{
+					// После ReleaseAll() куски сохраняются — продолжаем раздачу из следующего
+					++current_chunk;
+				}
+				else
+				{
+					chunks.push_back(std::make_unique<unsigned char[]>(block_size * kBlocksPerChunk));
+					current_chunk = chunks.size() - 1;
+				}
+				used_in_current = 0;
+			}
+			void* block = chunks[current_chunk].get() + block_size * used_in_current;
+			++used_in_current;
+			return block;
+		}
+
+		void Deallocate(void* block) noexcept
+		{
+			// Кладём блок в free-list; память вернётся системе при разрушении пула
+			*static_cast<void**>(block) = free_list;
+			free_list = block;
+		}
+
+		void ReleaseAll() noexcept
+		{
+			// Все куски остаются выделенными, но считаются свободными — O(1)
+			free_list = nullptr;
+			current_chunk = 0;
+			used_in_current = 0;
+		}
+	};
+
+	std::vector<std::unique_ptr<SubPool>> sub_pools;
+
+	SubPool& ForBlockSize(size_t block_size)
+	{
+		for (const std::unique_ptr<SubPool>& sub_pool : sub_pools)
+		{
+			if (sub_pool->block_size == block_size)
+			{
+				return *sub_pool;
+			}
+		}
+		sub_pools.push_back(std::make_unique<SubPool>());
+		sub_pools.back()->block_size = block_size;
+		return *sub_pools.back();
+	}
+};
+
+// Пул-аллокатор с блочным (slab) выделением памяти.
+// Выдаёт блоки размером sizeof(T) из заранее выделенных непрерывных кусков (chunks),
+// поэтому не обращается к куче на каждый элемент и не платит за метаданные malloc.
+// Освобождённые блоки складываются во внутренний free-list и переиспользуются.
+// Метод ReleaseAll() возвращает все блоки пулу за O(1) — им пользуется
+// SingleLinkedList::Clear() для типов с тривиальным деструктором.
+template <typename T>
+class PoolAllocator
+{
+private:
+	// Размер блока для T: не меньше размера указателя, чтобы в свободном блоке
+	// помещалась ссылка на следующий свободный блок
+	static constexpr size_t kBlockSize = (sizeof(T) < sizeof(void*)) ? sizeof(void*) : sizeof(T);
+
+	std::shared_ptr<PoolAllocatorPool> pool_;
+
+	template <typename U>
+	friend class PoolAllocator;
+
+public:
+	using value_type = T;
+
+	PoolAllocator()
+		: pool_(std::make_shared<PoolAllocatorPool>())
+	{
+
+	}
+
+	PoolAllocator(const PoolAllocator& other) noexcept = default;
+	PoolAllocator& operator=(const PoolAllocator& other) noexcept = default;
+
+	// Rebind-копия (например, из PoolAllocator<Type> в PoolAllocator<Node>).
+	// Разделяет пул исходного аллокатора: блоки другого размера берутся
+	// из своего подпула, поэтому rebind-копии сравниваются равными с оригиналом —
+	// без этого перенос узлов между списками (Append, SpliceAfter, Merge)
+	// с одним пулом был бы невозможен
+	template <typename U>
+	PoolAllocator(const PoolAllocator<U>& other) noexcept
+		: pool_(other.pool_)
+	{
+
+	}
+
+	T* allocate(size_t n)
+	{
+		// Пул рассчитан на поэлементное выделение узлов; массивы берём из кучи
+		if (n != 1u)
+		{
+			return static_cast<T*>(::operator new(sizeof(T) * n));
+		}
+		return static_cast<T*>(pool_->ForBlockSize(kBlockSize).Allocate());
+	}
+
+	void deallocate(T* ptr, size_t n) noexcept
+	{
+		if (n != 1u)
+		{
+			::operator delete(ptr);
+			return;
+		}
+		pool_->ForBlockSize(kBlockSize).Deallocate(ptr);
+	}
+
+	// true, когда этот аллокатор — единственный владелец пула: нет ни других
+	// копий, ни rebind-копий. Только тогда массовый сброс ReleaseAll() не может
+	// задеть блоки, выданные через другую копию, — контейнеры проверяют это
+	// перед быстрой очисткой
+	[[nodiscard]] bool OwnsPoolExclusively() const noexcept
+	{
+		return pool_.use_count() == 1;
+	}
+
+	// Возвращает пулу все выданные блоки размера T за O(1), не освобождая сами куски.
+	// Корректно только если объекты в блоках уже разрушены (или тривиально разрушаемы)
+	// и пулом владеет единственная копия аллокатора (см. OwnsPoolExclusively())
+	void ReleaseAll() noexcept
+	{
+		pool_->ForBlockSize(kBlockSize).ReleaseAll();
+	}
+
+	template <typename U>
+	bool operator==(const PoolAllocator<U>& rhs) const noexcept
+	{
+		return pool_.get() == rhs.pool_.get();
+	}
+
+	template <typename U>
+	bool operator!=(const PoolAllocator<U>& rhs) const noexcept
+	{
+		return !(*this == rhs);
+	}
+};
@@ -0,0 +1,325 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <utility>
+
+// Персистентный односвязный список со структурным разделением (copy-on-write).
+//
+// Копирование списка — O(1): копия разделяет цепочку узлов с оригиналом через
+// счётчики ссылок, ни один элемент не копируется. PushFront и PopFront тоже O(1)
+// и никогда не копируют узлы: голова просто перевешивается поверх общего хвоста.
+// Деструктивные операции в середине (InsertAfter/EraseAfter) копируют только
+// разделяемый префикс до места изменения — хвост после него остаётся общим.
+//
+// Счётчик ссылок узла — это число владельцев: списков, держащих его головой,
+// плюс узлов, ссылающихся на него как на следующий. Узел с счётчиком 1,
+// достижимый по эксклюзивному префиксу, принадлежит только этому списку.
+//
+// Значения доступны только на чтение (константные итераторы): узел может
+// разделяться с другими списками, и писать в него напрямую нельзя
+template <typename Type>
+class SharedSingleLinkedList
+{
+private:
+	struct Node
+	{
+		Node(const Type& val, Node* next)
+			: value(val)
+			, next_node(next)
+		{
+
+		}
+
+		Type value;
+		Node* next_node;
+		// Атомарный счётчик — снимки можно передавать в другие потоки
+		std::atomic<size_t> ref_count{1};
+	};
+
+	Node* head_ = nullptr;
+	size_t size_ = 0;
+
+	// Забирает ссылку на узел (новый владелец)
+	static void AddRef(Node* node) noexcept
+	{
+		if (node)
+		{
+			node->ref_count.fetch_add(1, std::memory_order_relaxed);
+		}
+	}
+
+	// Отпускает ссылку; умерший узел отпускает ссылку на следующий — итеративно,
+	// чтобы разрушение длинной эксклюзивной цепочки не рекурсировало по стеку
+	static void DecRef(Node* node) noexcept
+	{
+		while (node && node->ref_count.fetch_sub(1, std::memory_order_acq_rel) == 1)
+		{
+			Node* next = node->next_node;
+			delete node;
+			node = next;
+		}
+	}
+
+	/*
+	 * Делает узлы от головы до target включительно эксклюзивными для этого списка,
+	 * копируя разделяемый участок префикса. Хвост за target остаётся общим.
+	 * Возвращает собственный узел списка, соответствующий target
+	 */
+	Node* EnsureExclusive(Node* target)
+	{
+		Node** link = &head_;
+		Node* current = head_;
+		while (true)
+		{
+			assert(current);
+			if (current->ref_count.load(std::memory_order_acquire) > 1)
+			{
+				// Узел разделяется — копируем его; копия ссылается на прежний хвост
+				Node* copy = new Node(current->value, current->next_node);
+				AddRef(current->next_node);
+				*link = copy;
+				// Предшественник (или голова списка) больше не ссылается на оригинал
+				DecRef(current);
+				if (current == target)
+				{
+					return copy;
+				}
+				// Следующий узел теперь имеет ≥2 владельцев (старая цепочка + наша копия),
+				// поэтому на следующей итерации тоже будет скопирован
+				link = &copy->next_node;
+				current = copy->next_node;
+			}
+			else
+			{
+				if (current == target)
+				{
+					return current;
+				}
+				link = &current->next_node;
+				current = current->next_node;
+			}
+		}
+	}
+
+public:
+	using value_type = Type;
+
+	// Константный forward-итератор по разделяемой цепочке
+	class ConstIterator
+	{
+	private:
+		friend class SharedSingleLinkedList;
+
+		Node* node_ = nullptr;
+
+		explicit ConstIterator(Node* node) noexcept
+			: node_(node)
+		{
+
+		}
+
+	public:
+		using iterator_category = std::forward_iterator_tag;
+		using value_type = Type;
+		using difference_type = std::ptrdiff_t;
+		using pointer = const Type*;
+		using reference = const Type&;
+
+		ConstIterator() = default;
+
+		[[nodiscard]] bool operator==(const ConstIterator& rhs) const noexcept
+		{
+			return node_ == rhs.node_;
+		}
+
+		[[nodiscard]] bool operator!=(const ConstIterator& rhs) const noexcept
+		{
+			return !(*this == rhs);
+		}
+
+		ConstIterator& operator++() noexcept
+		{
+			assert(node_);
+			node_ = node_->next_node;
+			return *this;
+		}
+
+		ConstIterator operator++(int) noexcept
+		{
+			ConstIterator old_this(*this);
+			++(*this);
+			return old_this;
+		}
+
+		[[nodiscard]] reference operator*() const noexcept
+		{
+			assert(node_);
+			return node_->value;
+		}
+
+		[[nodiscard]] pointer operator->() const noexcept
+		{
+			assert(node_);
+			return &(node_->value);
+		}
+	};
+
+	using Iterator = ConstIterator;
+
+	SharedSingleLinkedList() = default;
+
+	SharedSingleLinkedList(std::initializer_list<Type> values)
+	{
+		// Вставляем с конца, чтобы сохранить порядок
+		for (auto it = std::rbegin(values); it != std::rend(values); ++it)
+		{
+			PushFront(*it);
+		}
+	}
+
+	// Снимок за O(1): цепочка разделяется, копируется только пара указатель+размер
+	SharedSingleLinkedList(const SharedSingleLinkedList& other) noexcept
+		: head_(other.head_)
+		, size_(other.size_)
+	{
+		AddRef(head_);
+	}
+
+	SharedSingleLinkedList& operator=(const SharedSingleLinkedList& rhs) noexcept
+	{
+		if (this != &rhs)
+		{
+			AddRef(rhs.head_);
+			DecRef(head_);
+			head_ = rhs.head_;
+			size_ = rhs.size_;
+		}
+		return *this;
+	}
+
+	SharedSingleLinkedList(SharedSingleLinkedList&& other) noexcept
+		: head_(std::exchange(other.head_, nullptr))
+		, size_(std::exchange(other.size_, 0))
+	{
+
+	}
+
+	SharedSingleLinkedList& operator=(SharedSingleLinkedList&& rhs) noexcept
+	{
+		if (this != &rhs)
+		{
+			DecRef(head_);
+			head_ = std::exchange(rhs.head_, nullptr);
+			size_ = std::exchange(rhs.size_, 0);
+		}
+		return *this;
+	}
+
+	~SharedSingleLinkedList()
+	{
+		DecRef(head_);
+	}
+
+	// Вставляет элемент в начало за O(1) даже для разделяемого списка:
+	// новая голова вешается поверх общего хвоста, ничего не копируется
+	void PushFront(const Type& value)
+	{
+		// Ссылка на старую голову переходит от списка к новому узлу
+		head_ = new Node(value, head_);
+		++size_;
+	}
+
+	// Удаляет первый элемент за O(1) без копирования: список отпускает голову
+	// и начинает ссылаться на следующий узел
+	void PopFront() noexcept
+	{
+		assert(head_);
+		Node* old_head = head_;
+		head_ = old_head->next_node;
+		AddRef(head_);
+		DecRef(old_head);
+		--size_;
+	}
+
+	/*
+	 * Вставляет элемент после pos. Если префикс до pos разделяется с другими
+	 * списками, он один раз копируется (copy-on-write); хвост остаётся общим.
+	 * Возвращает итератор на вставленный элемент
+	 */
+	ConstIterator InsertAfter(ConstIterator pos, const Type& value)
+	{
+		Node* exclusive = EnsureExclusive(pos.node_);
+		// Ссылка на прежний хвост переходит от exclusive к новому узлу
+		Node* new_node = new Node(value, exclusive->next_node);
+		exclusive->next_node = new_node;
+		++size_;
+		return ConstIterator(new_node);
+	}
+
+	/*
+	 * Удаляет элемент, следующий за pos, с копированием разделяемого префикса
+	 * до pos включительно. Возвращает итератор на элемент за удалённым
+	 */
+	ConstIterator EraseAfter(ConstIterator pos)
+	{
+		Node* exclusive = EnsureExclusive(pos.node_);
+		Node* victim = exclusive->next_node;
+		assert(victim);
+		exclusive->next_node = victim->next_node;
+		AddRef(victim->next_node);
+		DecRef(victim);
+		--size_;
+		return ConstIterator(exclusive->next_node);
+	}
+
+	[[nodiscard]] size_t GetSize() const noexcept
+	{
+		return size_;
+	}
+
+	[[nodiscard]] bool IsEmpty() const noexcept
+	{
+		return size_ == 0;
+	}
+
+	[[nodiscard]] ConstIterator begin() const noexcept
+	{
+		return ConstIterator(head_);
+	}
+
+	[[nodiscard]] ConstIterator end() const noexcept
+	{
+		return ConstIterator();
+	}
+
+	[[nodiscard]] ConstIterator cbegin() const noexcept
+	{
+		return begin();
+	}
+
+	[[nodiscard]] ConstIterator cend() const noexcept
+	{
+		return end();
+	}
+};
+
+template <typename Type>
+bool operator==(const SharedSingleLinkedList<Type>& lhs, const SharedSingleLinkedList<Type>& rhs)
+{
+	if (lhs.GetSize() != rhs.GetSize())
+	{
+		return false;
+	}
+	return std::equal(lhs.begin(), lhs.end(), rhs.begin());
+}
+
+template <typename Type>
+bool operator!=(const SharedSingleLinkedList<Type>& lhs, const SharedSingleLinkedList<Type>& rhs)
+{
+	return !(lhs == rhs);
+}
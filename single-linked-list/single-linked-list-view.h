@@ -0,0 +1,284 @@
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+
+#include "single-linked-list.h"
+
+// Просмотр снапшота списка без копирования данных (POSIX: mmap)
+#if defined(__unix__) || defined(__APPLE__)
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// Формат файла-снапшота:
+//   [uint64_t count][выравнивание][Record 0][Record 1]...[Record count-1]
+// где Record = { Type value; uint64_t next_offset }, а next_offset — байтовое
+// смещение следующей записи от начала файла (0 — конец списка).
+// Смещения вместо указателей делают образ позиционно-независимым:
+// его можно отобразить в память по любому адресу.
+//
+// SingleLinkedListView отображает такой файл через mmap и предоставляет
+// тот же forward-итераторный интерфейс (begin/end/cbegin/cend, GetSize,
+// IsEmpty), что и SingleLinkedList, — шаблонные потребители работают
+// с ним без изменений. Холодный старт сводится к отображению страниц:
+// ОС подгружает только реально обходимую часть снапшота
+template <typename Type>
+class SingleLinkedListView
+{
+	static_assert(std::is_trivially_copyable_v<Type>,
+		"SingleLinkedListView поддерживает только тривиально копируемые типы");
+
+private:
+	// Запись снапшота: значение + смещение следующей записи от начала файла
+	struct Record
+	{
+		Type value;
+		uint64_t next_offset;
+	};
+
+	// Смещение первой записи: заголовок, добитый до выравнивания Record
+	static constexpr uint64_t kFirstRecordOffset =
+		((sizeof(uint64_t) + alignof(Record) - 1) / alignof(Record)) * alignof(Record);
+
+	const unsigned char* mapping_ = nullptr;
+	size_t mapping_size_ = 0;
+	uint64_t count_ = 0;
+
+public:
+	using value_type = Type;
+
+	// Итератор по отображённому снапшоту: переход к следующему элементу —
+	// прыжок по смещению next_offset внутри отображения. Смещения приходят
+	// из файла, поэтому operator++ проверяет их границы и бросает
+	// std::runtime_error на испорченном снапшоте вместо чтения мимо отображения
+	class ConstIterator
+	{
+	private:
+		friend class SingleLinkedListView;
+
+		const unsigned char* base_ = nullptr;
+		const Record* record_ = nullptr;
+		size_t mapping_size_ = 0;
+
+		ConstIterator(const unsigned char* base, const Record* record, size_t mapping_size) noexcept
+			: base_(base)
+			, record_(record)
+			, mapping_size_(mapping_size)
+		{
+
+		}
+
+	public:
+		using iterator_category = std::forward_iterator_tag;
+		using value_type = Type;
+		using difference_type = std::ptrdiff_t;
+		using pointer = const Type*;
+		using reference = const Type&;
+
+		ConstIterator() = default;
+
+		[[nodiscard]] bool operator==(const ConstIterator& rhs) const noexcept
+		{
+			return record_ == rhs.record_;
+		}
+
+		[[nodiscard]] bool operator!=(const ConstIterator& rhs) const noexcept
+		{
+			return !(*this == rhs);
+		}
+
+		ConstIterator& operator++()
+		{
+			if (record_)
+			{
+				const uint64_t next = record_->next_offset;
+				if (next == 0)
+				{
+					record_ = nullptr;
+				}
+				else
+				{
+					// Смещение из файла обязано указывать на целую запись
+					// внутри отображения, не раньше первой
+					if (next < kFirstRecordOffset || next > mapping_size_
+						|| mapping_size_ - next < sizeof(Record))
+					{
+						throw std::runtime_error("Файл снапшота повреждён (смещение за пределами отображения)."s);
+					}
+					record_ = reinterpret_cast<const Record*>(base_ + next);
+				}
+			}
+			else
+			{
+				assert(false);
+			}
+			return *this;
+		}
+
+		ConstIterator operator++(int)
+		{
+			ConstIterator old_this(*this);
+			++(*this);
+			return old_this;
+		}
+
+		[[nodiscard]] reference operator*() const noexcept
+		{
+			assert(record_);
+			return record_->value;
+		}
+
+		[[nodiscard]] pointer operator->() const noexcept
+		{
+			assert(record_);
+			return &(record_->value);
+		}
+	};
+
+	using Iterator = ConstIterator; // представление только для чтения
+
+	// Отображает файл-снапшот в память. Бросает std::runtime_error,
+	// если файл не открывается, повреждён или усечён
+	explicit SingleLinkedListView(const std::string& path)
+	{
+		const int fd = ::open(path.c_str(), O_RDONLY);
+		if (fd < 0)
+		{
+			throw std::runtime_error("Не удалось открыть файл снапшота: "s + path);
+		}
+
+		struct stat file_info
+		{
+		};
+		if (::fstat(fd, &file_info) != 0)
+		{
+			::close(fd);
+			throw std::runtime_error("Не удалось получить размер файла снапшота: "s + path);
+		}
+		mapping_size_ = static_cast<size_t>(file_info.st_size);
+		if (mapping_size_ < sizeof(uint64_t))
+		{
+			::close(fd);
+			throw std::runtime_error("Файл снапшота усечён: "s + path);
+		}
+
+		void* mapping = ::mmap(nullptr, mapping_size_, PROT_READ, MAP_PRIVATE, fd, 0);
+		::close(fd); // после mmap дескриптор больше не нужен
+		if (mapping == MAP_FAILED)
+		{
+			throw std::runtime_error("Не удалось отобразить файл снапшота: "s + path);
+		}
+		mapping_ = static_cast<const unsigned char*>(mapping);
+
+		std::memcpy(&count_, mapping_, sizeof(count_));
+		// Сверяем count_ с размером отображения делением, а не умножением:
+		// у испорченного заголовка огромный count_ переполнил бы произведение
+		// count_ * sizeof(Record) и проскочил бы проверку
+		const bool size_consistent = (count_ == 0)
+			|| (mapping_size_ >= kFirstRecordOffset + sizeof(Record)
+				&& count_ <= (mapping_size_ - kFirstRecordOffset) / sizeof(Record));
+		if (!size_consistent)
+		{
+			::munmap(const_cast<unsigned char*>(mapping_), mapping_size_);
+			throw std::runtime_error("Файл снапшота повреждён (несогласованный размер): "s + path);
+		}
+	}
+
+	SingleLinkedListView(const SingleLinkedListView&) = delete;
+	SingleLinkedListView& operator=(const SingleLinkedListView&) = delete;
+
+	SingleLinkedListView(SingleLinkedListView&& other) noexcept
+		: mapping_(std::exchange(other.mapping_, nullptr))
+		, mapping_size_(std::exchange(other.mapping_size_, 0))
+		, count_(std::exchange(other.count_, 0))
+	{
+
+	}
+
+	~SingleLinkedListView()
+	{
+		if (mapping_)
+		{
+			::munmap(const_cast<unsigned char*>(mapping_), mapping_size_);
+		}
+	}
+
+	[[nodiscard]] size_t GetSize() const noexcept
+	{
+		return count_;
+	}
+
+	[[nodiscard]] bool IsEmpty() const noexcept
+	{
+		return count_ == 0;
+	}
+
+	[[nodiscard]] ConstIterator begin() const noexcept
+	{
+		if (count_ == 0)
+		{
+			return ConstIterator();
+		}
+		return ConstIterator(mapping_, reinterpret_cast<const Record*>(mapping_ + kFirstRecordOffset), mapping_size_);
+	}
+
+	[[nodiscard]] ConstIterator end() const noexcept
+	{
+		return ConstIterator();
+	}
+
+	[[nodiscard]] ConstIterator cbegin() const noexcept
+	{
+		return begin();
+	}
+
+	[[nodiscard]] ConstIterator cend() const noexcept
+	{
+		return end();
+	}
+
+	/*
+	 * Записывает снапшот списка в поток в формате, который читает SingleLinkedListView.
+	 * Записи идут в порядке списка, поэтому смещения next_offset последовательны
+	 * и обход снапшота дружелюбен к предвыборке страниц
+	 */
+	template <typename Allocator>
+	static void WriteSnapshot(const SingleLinkedList<Type, Allocator>& list, std::ostream& out)
+	{
+		const uint64_t count = list.GetSize();
+		out.write(reinterpret_cast<const char*>(&count), sizeof(count));
+
+		// Добивка заголовка до выравнивания первой записи
+		for (uint64_t pad = sizeof(uint64_t); pad < kFirstRecordOffset; ++pad)
+		{
+			out.put('\0');
+		}
+
+		uint64_t offset = kFirstRecordOffset;
+		uint64_t written = 0;
+		for (const Type& value : list)
+		{
+			++written;
+			Record record{};
+			record.value = value;
+			record.next_offset = (written < count) ? offset + sizeof(Record) : 0;
+			out.write(reinterpret_cast<const char*>(&record), sizeof(record));
+			offset += sizeof(Record);
+		}
+
+		if (!out)
+		{
+			throw std::runtime_error("Ошибка записи потока в методе WriteSnapshot."s);
+		}
+	}
+};
+
+#endif // defined(__unix__) || defined(__APPLE__)
@@ -1,29 +1,287 @@
 #pragma once
 
+#include <array>
 #include <cassert>
+#include <condition_variable>
 #include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <mutex>
+#include <functional>
+#include <memory>
+#include <new>
+#include <stdexcept>
 #include <string>
+#include <thread>
+#include <type_traits>
 #include <utility>
+#include <vector>
 #include <iostream>
 
 #include <iterator>
 
+// Сэмплирующая трассировка горячих путей; без -DSLL_ENABLE_TRACING
+// макрос SLL_TRACE_SCOPE раскрывается в пустоту
+#include "list-trace.h"
+
 using namespace std::literals;
 
+// constexpr для методов с динамической аллокацией: разрешено начиная с C++20.
+// В более ранних стандартах макрос раскрывается в пустоту, и те же методы
+// остаются обычными (списки строятся только во время выполнения)
+#if defined(__cpp_constexpr_dynamic_alloc) && __cpp_constexpr_dynamic_alloc >= 201907L
+#define SLL_CONSTEXPR20 constexpr
+#else
+#define SLL_CONSTEXPR20
+#endif
+
+// Подсказка процессору подтянуть кеш-линию по адресу ptr (no-op на компиляторах без поддержки)
+inline void PrefetchForRead(const void* ptr) noexcept
+{
+#if defined(__GNUC__) || defined(__clang__)
+	__builtin_prefetch(ptr, /*rw=*/0, /*locality=*/3);
+#else
+	(void)ptr;
+#endif
+}
+
+// Атомарные загрузка и публикация указателя для конкурентного обхода:
+// писатель EraseAfterDeferred перешивает ссылку release-записью, а читающий
+// итератор и begin() берут её acquire-загрузкой. Без этой пары «читатели
+// под ReadGuard + пишущий поток» были бы гонкой данных по next_node, а не
+// только задачей отложенного освобождения. На x86 обе операции компилируются
+// в обычные mov, поэтому однопоточный обход ничего не платит.
+// В константных вычислениях вырождаются в обычные обращения
+template <typename T>
+SLL_CONSTEXPR20 T* AtomicLoadAcquire(T* const* location) noexcept
+{
+#if defined(__GNUC__) || defined(__clang__)
+#if defined(__cpp_lib_is_constant_evaluated)
+	if (std::is_constant_evaluated())
+	{
+		return *location;
+	}
+#endif
+	return __atomic_load_n(location, __ATOMIC_ACQUIRE);
+#else
+	return *location;
+#endif
+}
+
+template <typename T>
+SLL_CONSTEXPR20 void AtomicStoreRelease(T** location, T* value) noexcept
+{
+#if defined(__GNUC__) || defined(__clang__)
+#if defined(__cpp_lib_is_constant_evaluated)
+	if (std::is_constant_evaluated())
+	{
+		*location = value;
+		return;
+	}
+#endif
+	__atomic_store_n(location, value, __ATOMIC_RELEASE);
+#else
+	*location = value;
+#endif
+}
+
+// Трейт: есть ли у аллокатора метод ReleaseAll() для массового возврата блоков за O(1)
+// (им обладает, например, PoolAllocator из pool-allocator.h)
+template <typename Alloc, typename = void>
+struct AllocatorHasReleaseAll : std::false_type {};
+
+template <typename Alloc>
+struct AllocatorHasReleaseAll<Alloc, std::void_t<decltype(std::declval<Alloc&>().ReleaseAll())>> : std::true_type {};
+
+// Трейт: умеет ли аллокатор сообщать о единоличном владении пулом
+// (OwnsPoolExclusively() у PoolAllocator). Быстрая очистка через ReleaseAll()
+// допустима только при единоличном владении: копии и rebind-копии разделяют
+// пул, и массовый сброс под чужими живыми узлами портил бы память
+template <typename Alloc, typename = void>
+struct AllocatorHasExclusiveOwnershipCheck : std::false_type {};
+
+template <typename Alloc>
+struct AllocatorHasExclusiveOwnershipCheck<Alloc, std::void_t<decltype(std::declval<const Alloc&>().OwnsPoolExclusively())>> : std::true_type {};
+
+// Счётчики операций и аллокаций списка (см. параметр EnableStats у SingleLinkedList)
+struct ListStats
+{
+	size_t nodes_allocated = 0;    // узлов выделено этим списком
+	size_t nodes_deallocated = 0;  // узлов освобождено этим списком
+	size_t push_front_calls = 0;   // вызовов PushFront/EmplaceFront
+	size_t push_back_calls = 0;    // вызовов PushBack/EmplaceBack
+	size_t pop_front_calls = 0;    // вызовов PopFront
+	size_t insert_after_calls = 0; // вызовов InsertAfter/EmplaceAfter
+	size_t erase_after_calls = 0;  // вызовов EraseAfter (включая отложенный)
+	size_t peak_size = 0;          // максимальный наблюдавшийся размер
+	size_t bytes_held = 0;         // байт под узлами сейчас (заполняется в GetStats)
+};
+
+// База с хранилищем счётчиков: подмешивается только при EnableStats = true,
+// при false пустая база ничего не добавляет к размеру списка (EBO)
+struct ListStatsHolder
+{
+	ListStats stats_;
+};
+
+struct ListStatsEmpty
+{
+};
+
+// База с кешированным дайджестом содержимого: подмешивается при EnableDigest = true.
+// Поля mutable — ленивый пересчёт выполняется и из const-методов
+struct ListDigestHolder
+{
+	mutable uint64_t digest_ = 0;
+	mutable bool digest_dirty_ = false;
+};
+
+struct ListDigestEmpty
+{
+};
+
+// Фоновый освободитель цепочек для ClearAsync(): один ленивый поток на процесс
+// вместо потока на вызов. Задачи (разрушение отцепленной цепочки) встают в очередь,
+// а Flush() дожидается завершения всех уже поставленных — этим пользуются тесты
+// и код, которому нужно дожать фоновые деструкторы в детерминированной точке.
+// При завершении программы поток дорабатывает очередь и присоединяется,
+// поэтому деструкторы элементов не переживают разрушение статиков
+class ListAsyncReclaimer
+{
+public:
+	static ListAsyncReclaimer& Instance()
+	{
+		static ListAsyncReclaimer reclaimer;
+		return reclaimer;
+	}
+
+	// Ставит задачу освобождения в очередь; рабочий поток запускается при первом вызове
+	void Submit(std::function<void()> task)
+	{
+		{
+			std::lock_guard<std::mutex> lock(mutex_);
+			if (!worker_.joinable())
+			{
+				worker_ = std::thread([this] { WorkerLoop(); });
+			}
+			tasks_.push_back(std::move(task));
+		}
+		tasks_available_.notify_one();
+	}
+
+	// Дожидается завершения всех задач, поставленных к этому моменту
+	void Flush()
+	{
+		std::unique_lock<std::mutex> lock(mutex_);
+		all_done_.wait(lock, [this] { return tasks_.empty() && !busy_; });
+	}
+
+	ListAsyncReclaimer(const ListAsyncReclaimer&) = delete;
+	ListAsyncReclaimer& operator=(const ListAsyncReclaimer&) = delete;
+
+private:
+	ListAsyncReclaimer() = default;
+
+	~ListAsyncReclaimer()
+	{
+		{
+			std::lock_guard<std::mutex> lock(mutex_);
+			stopping_ = true;
+		}
+		tasks_available_.notify_one();
+		if (worker_.joinable())
+		{
+			worker_.join();
+		}
+	}
+
+	void WorkerLoop()
+	{
+		std::unique_lock<std::mutex> lock(mutex_);
+		for (;;)
+		{
+			tasks_available_.wait(lock, [this] { return stopping_ || !tasks_.empty(); });
+			if (tasks_.empty())
+			{
+				// Остановка с пустой очередью — все задачи дожаты
+				return;
+			}
+			std::function<void()> task = std::move(tasks_.front());
+			tasks_.erase(tasks_.begin());
+			busy_ = true;
+			lock.unlock();
+			// Деструкторы элементов выполняются вне замка
+			task();
+			lock.lock();
+			busy_ = false;
+			if (tasks_.empty())
+			{
+				all_done_.notify_all();
+			}
+		}
+	}
+
+	std::mutex mutex_;
+	std::condition_variable tasks_available_;
+	std::condition_variable all_done_;
+	std::vector<std::function<void()>> tasks_;
+	std::thread worker_;
+	bool busy_ = false;
+	bool stopping_ = false;
+};
+
+// Предварительное объявление конкурентного собрата (lock-free-single-linked-list.h):
+// ему нужен доступ к приватному типу Node, чтобы отдавать украденные цепочки
+// обычному SingleLinkedList без копирования
 template <typename Type>
+class LockFreeSingleLinkedList;
+
+// Параметр EnableStats включает слой учёта (ListStats): счётчики операций,
+// аллокаций и пиковый размер через GetStats(). При false слой не добавляет
+// ни байта к объекту и ни одной инструкции к горячим путям.
+//
+// Параметр Checked управляет проверками валидности итераторов: при true (по
+// умолчанию) разыменование и инкремент проверяют node_, а InsertAfter бросает
+// std::invalid_argument на нулевом итераторе; при false эти проверки и
+// машинерия исключений выбрасываются на этапе компиляции, и горячие циклы
+// получают прямолинейный код — та же пара гарантий, что у at() и operator[].
+//
+// Параметр EnableDigest поддерживает порядкозависимый скользящий хеш содержимого:
+// PushFront обновляет его за O(1), остальные мутации помечают его устаревшим,
+// и он лениво пересчитывается при следующем GetDigest(). operator== сравнивает
+// размер и дайджест до обхода цепочек, поэтому несовпадающие списки отклоняются
+// за O(1) — на нагрузках «сравнить те же большие списки тысячи раз» это убирает
+// почти все полные проходы. Требует хешируемого std::hash типа Type.
+// Внимание: запись в элементы напрямую через итераторы или ForEach мимо методов
+// списка дайджест не видит — такие списки следует менять только через API
+template <typename Type, typename Allocator = std::allocator<Type>, bool EnableStats = false, bool Checked = true, bool EnableDigest = false>
 class SingleLinkedList
+	: private std::conditional_t<EnableStats, ListStatsHolder, ListStatsEmpty>
+	, private std::conditional_t<EnableDigest, ListDigestHolder, ListDigestEmpty>
 {
+	friend class LockFreeSingleLinkedList<Type>;
+
 private:
 	// Узел списка
 	struct Node
 	{
 		Node() = default;
 
-		Node(const Type& val, Node* next)
+		SLL_CONSTEXPR20 Node(const Type& val, Node* next)
 			: value(val)
 			, next_node(next)
 		{
 
+		}
+
+		// Конструирует значение прямо внутри узла из произвольного набора аргументов
+		// (используется emplace-методами и перемещающими вставками)
+		template <typename... Args>
+		SLL_CONSTEXPR20 explicit Node(Node* next, Args&&... args)
+			: value(std::forward<Args>(args)...)
+			, next_node(next)
+		{
+
 		}
 		Type value;
 		Node* next_node = nullptr;
@@ -40,7 +298,7 @@ private:
 		// был доступ к приватной области итератора
 		friend class SingleLinkedList;
 		// Конвертирующий конструктор итератора из указателя на узел списка
-		explicit BasicIterator(Node* node)
+		SLL_CONSTEXPR20 explicit BasicIterator(Node* node)
 		{
 			node_ = node;
 		}
@@ -65,7 +323,7 @@ private:
 		// Конвертирующий конструктор/конструктор копирования
 		// При ValueType, совпадающем с Type, играет роль копирующего конструктора
 		// При ValueType, совпадающем с const Type, играет роль конвертирующего конструктора
-		BasicIterator(const BasicIterator<Type>& other) noexcept
+		SLL_CONSTEXPR20 BasicIterator(const BasicIterator<Type>& other) noexcept
 		{
 			node_ = other.node_;
 		}
@@ -77,28 +335,28 @@ private:
 
 		// Оператор сравнения итераторов (в роли второго аргумента выступает константный итератор)
 		// Два итератора равны, если они ссылаются на один и тот же элемент списка либо на end()
-		[[nodiscard]] bool operator==(const BasicIterator<const Type>& rhs) const noexcept
+		[[nodiscard]] SLL_CONSTEXPR20 bool operator==(const BasicIterator<const Type>& rhs) const noexcept
 		{
 			return (this->node_ == rhs.node_);
 		}
 
 		// Оператор проверки итераторов на неравенство
 		// Противоположен !=
-		[[nodiscard]] bool operator!=(const BasicIterator<const Type>& rhs) const noexcept
+		[[nodiscard]] SLL_CONSTEXPR20 bool operator!=(const BasicIterator<const Type>& rhs) const noexcept
 		{
 			return !(this->node_ == rhs.node_);
 		}
 
 		// Оператор сравнения итераторов (в роли второго аргумента итератор)
 		// Два итератора равны, если они ссылаются на один и тот же элемент списка либо на end()
-		[[nodiscard]] bool operator==(const BasicIterator<Type>& rhs) const noexcept
+		[[nodiscard]] SLL_CONSTEXPR20 bool operator==(const BasicIterator<Type>& rhs) const noexcept
 		{
 			return (this->node_ == rhs.node_);
 		}
 
 		// Оператор проверки итераторов на неравенство
 		// Противоположен !=
-		[[nodiscard]] bool operator!=(const BasicIterator<Type>& rhs) const noexcept
+		[[nodiscard]] SLL_CONSTEXPR20 bool operator!=(const BasicIterator<Type>& rhs) const noexcept
 		{
 			return !(this->node_ == rhs.node_);
 		}
@@ -106,24 +364,26 @@ private:
 		// Оператор прединкремента (префиксаня версия). После его вызова итератор указывает на следующий элемент списка
 		// Возвращает ссылку на самого себя
 		// Инкремент итератора, не указывающего на существующий элемент списка, приводит к неопределённому поведению
-		BasicIterator& operator++() noexcept
+		SLL_CONSTEXPR20 BasicIterator& operator++() noexcept
 		{
-			if (node_)
-			{
-				node_ = node_->next_node;
-				return *this;
-			}
-			else
+			if constexpr (Checked)
 			{
-				assert(false);
+				if (!node_)
+				{
+					assert(false);
+				}
 			}
+			// Acquire-загрузка ссылки: обход под ReadGuard может идти параллельно
+			// с EraseAfterDeferred, публикующим перешитые ссылки release-записью
+			node_ = AtomicLoadAcquire(&node_->next_node);
+			return *this;
 		}
 
 		// Оператор постинкремента (постфиксная). После его вызова итератор указывает на следующий элемент списка
 		// Возвращает прежнее значение итератора
 		// Инкремент итератора, не указывающего на существующий элемент списка,
 		// приводит к неопределённому поведению
-		BasicIterator operator++(int) noexcept
+		SLL_CONSTEXPR20 BasicIterator operator++(int) noexcept
 		{
 			BasicIterator old_this(*this);
 			++(*this);
@@ -133,31 +393,31 @@ private:
 		// Операция разыменования. Возвращает ссылку на текущий элемент
 		// Вызов этого оператора у итератора, не указывающего на существующий элемент списка,
 		// приводит к неопределённому поведению
-		[[nodiscard]] reference operator*() const noexcept
+		[[nodiscard]] SLL_CONSTEXPR20 reference operator*() const noexcept
 		{
-			if (node_)
-			{
-				return (node_->value);
-			}
-			else
+			if constexpr (Checked)
 			{
-				assert(false);
+				if (!node_)
+				{
+					assert(false);
+				}
 			}
+			return (node_->value);
 		}
 
 		// Операция доступа к члену класса. Возвращает указатель на текущий элемент списка
 		// Вызов этого оператора у итератора, не указывающего на существующий элемент списка,
 		// приводит к неопределённому поведению
-		[[nodiscard]] pointer operator->() const noexcept
+		[[nodiscard]] SLL_CONSTEXPR20 pointer operator->() const noexcept
 		{
-			if (node_)
+			if constexpr (Checked)
 			{
-				return &(node_->value);
-			}
-			else
-			{
-				assert(false);
+				if (!node_)
+				{
+					assert(false);
+				}
 			}
+			return &(node_->value);
 		}
 
 	private:
@@ -165,15 +425,291 @@ private:
 	};
 
 private:
+	// Аллокатор, перепривязанный (rebind) с Type на Node: контейнер выделяет узлы, а не «голые» значения
+	using NodeAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<Node>;
+	using NodeAllocatorTraits = std::allocator_traits<NodeAllocator>;
+
+	// Звено кеша переработки: размещается в памяти разрушенного узла
+	// и связывает свободные блоки в цепочку (см. SetNodeCacheLimit)
+	struct FreeNode
+	{
+		FreeNode* next;
+	};
+
 	// Фиктивный узел, используется для вставки "перед первым элементом"
 	Node head_;
 	size_t size_;
+	// Кешированный указатель на последний узел: nullptr для пустого списка.
+	// Поддерживается всеми модифицирующими методами и даёт O(1) PushBack и Append
+	Node* tail_ = nullptr;
+	NodeAllocator node_alloc_;
+	// Кеш переработанных узлов: пока он не пуст, вставки не обращаются к аллокатору.
+	// free_limit_ == 0 (по умолчанию) выключает переработку полностью
+	FreeNode* free_list_ = nullptr;
+	size_t free_count_ = 0;
+	size_t free_limit_ = 0;
+
+	// Выделяет и конструирует узел; память берётся из кеша переработки,
+	// если он не пуст, иначе — у аллокатора. При исключении из конструктора
+	// значения память возвращается аллокатору, поэтому вызывающие методы
+	// сохраняют строгую гарантию
+	template <typename... Args>
+	SLL_CONSTEXPR20 Node* CreateNode(Node* next, Args&&... args)
+	{
+		Node* node;
+		if (free_list_)
+		{
+			node = reinterpret_cast<Node*>(std::exchange(free_list_, free_list_->next));
+			--free_count_;
+		}
+		else
+		{
+			node = NodeAllocatorTraits::allocate(node_alloc_, 1);
+		}
+		try
+		{
+			NodeAllocatorTraits::construct(node_alloc_, node, next, std::forward<Args>(args)...);
+		}
+		catch (...)
+		{
+			NodeAllocatorTraits::deallocate(node_alloc_, node, 1);
+			throw;
+		}
+		StatsOnNodeCreated();
+		return node;
+	}
+
+	// Разрушает значение узла; память уходит в кеш переработки,
+	// пока тот не достиг предела, иначе возвращается аллокатору
+	SLL_CONSTEXPR20 void DestroyNode(Node* node) noexcept
+	{
+		NodeAllocatorTraits::destroy(node_alloc_, node);
+		if (free_count_ < free_limit_)
+		{
+			FreeNode* slot = ::new (static_cast<void*>(node)) FreeNode{free_list_};
+			free_list_ = slot;
+			++free_count_;
+		}
+		else
+		{
+			NodeAllocatorTraits::deallocate(node_alloc_, node, 1);
+		}
+		StatsOnNodeDestroyed();
+	}
+
+	// Тесный цикл разрушения отсоединённой цепочки: в отличие от поэлементного
+	// PopFront не трогает size_/tail_ на каждой итерации — только разрушение
+	// и освобождение узлов подряд
+	SLL_CONSTEXPR20 void DestroyChain(Node* node) noexcept
+	{
+		while (node)
+		{
+			DestroyNode(std::exchange(node, node->next_node));
+		}
+	}
+
+	// Возвращает аллокатору блоки кеша переработки сверх keep штук
+	SLL_CONSTEXPR20 void ReleaseCachedNodes(size_t keep) noexcept
+	{
+		while (free_count_ > keep)
+		{
+			FreeNode* slot = std::exchange(free_list_, free_list_->next);
+			NodeAllocatorTraits::deallocate(node_alloc_, reinterpret_cast<Node*>(slot), 1);
+			--free_count_;
+		}
+	}
+
+	// Принимает во владение готовую цепочку узлов за O(1).
+	// Вызывается только на пустом списке; узлы должны быть выделены
+	// аллокатором, взаимозаменяемым с аллокатором списка
+	void AdoptChain(Node* first, Node* last, size_t count) noexcept
+	{
+		assert(IsEmpty());
+		head_.next_node = first;
+		tail_ = last;
+		size_ = count;
+		StatsOnSizeChanged();
+		DigestMarkDirty();
+	}
+
+	// Хуки слоя статистики: при выключенном EnableStats ветки отбрасываются
+	// на этапе компиляции и не стоят ни одной инструкции
+	SLL_CONSTEXPR20 void StatsOnNodeCreated() noexcept
+	{
+		if constexpr (EnableStats)
+		{
+			++this->stats_.nodes_allocated;
+		}
+	}
+
+	SLL_CONSTEXPR20 void StatsOnNodeDestroyed() noexcept
+	{
+		if constexpr (EnableStats)
+		{
+			++this->stats_.nodes_deallocated;
+		}
+	}
+
+	// Обновляет пиковый размер; вызывается после любого роста size_
+	SLL_CONSTEXPR20 void StatsOnSizeChanged() noexcept
+	{
+		if constexpr (EnableStats)
+		{
+			if (this->size_ > this->stats_.peak_size)
+			{
+				this->stats_.peak_size = this->size_;
+			}
+		}
+	}
+
+	// Множитель скользящего хеша (простое число FNV): дайджест списка —
+	// это h(x0) + P*h(x1) + P^2*h(x2) + ..., поэтому добавление элемента
+	// в начало обновляет его за O(1): digest' = h(x) + P * digest
+	static constexpr uint64_t kDigestPrime = 1099511628211ull;
+
+	// Хуки слоя дайджеста — no-op при выключенном EnableDigest
+	SLL_CONSTEXPR20 void DigestOnPushFront(const Type& value) noexcept
+	{
+		if constexpr (EnableDigest)
+		{
+			if (!this->digest_dirty_)
+			{
+				this->digest_ = std::hash<Type>{}(value) + kDigestPrime * this->digest_;
+			}
+		}
+	}
+
+	// Помечает дайджест устаревшим: вызывается мутациями, которые
+	// не обновляют его инкрементально
+	SLL_CONSTEXPR20 void DigestMarkDirty() noexcept
+	{
+		if constexpr (EnableDigest)
+		{
+			this->digest_dirty_ = true;
+		}
+	}
+
+	// Сбрасывает дайджест в значение пустого списка
+	SLL_CONSTEXPR20 void DigestReset() noexcept
+	{
+		if constexpr (EnableDigest)
+		{
+			this->digest_ = 0;
+			this->digest_dirty_ = false;
+		}
+	}
+
+	/*
+	 * Делит цепочку из count узлов на num_threads примерно равных сегментов
+	 * (один подготовительный проход — границы известны благодаря size_)
+	 * и обходит сегменты параллельно, вызывая visit(узел) в потоке сегмента
+	 */
+	template <typename Visitor>
+	static void ParallelWalk(const Node* first, size_t count, size_t num_threads, Visitor visit)
+	{
+		if (num_threads > count)
+		{
+			num_threads = count;
+		}
+		if (num_threads <= 1)
+		{
+			for (const Node* node = first; node; node = node->next_node)
+			{
+				visit(node);
+			}
+			return;
+		}
+
+		// Подготовительный проход: запоминаем узлы-начала сегментов.
+		// Первые count % num_threads сегментов длиннее остальных на один узел
+		std::vector<const Node*> starts;
+		starts.reserve(num_threads + 1);
+		const size_t base_length = count / num_threads;
+		const size_t longer_segments = count % num_threads;
+		const Node* node = first;
+		for (size_t segment = 0; segment < num_threads; ++segment)
+		{
+			starts.push_back(node);
+			const size_t length = base_length + ((segment < longer_segments) ? 1u : 0u);
+			for (size_t i = 0; i < length; ++i)
+			{
+				node = node->next_node;
+			}
+		}
+		// После последнего сегмента — конец списка
+		starts.push_back(nullptr);
+
+		std::vector<std::thread> workers;
+		workers.reserve(num_threads);
+		for (size_t segment = 0; segment < num_threads; ++segment)
+		{
+			workers.emplace_back([&visit, begin = starts[segment], end = starts[segment + 1]]()
+			{
+				for (const Node* current = begin; current != end; current = current->next_node)
+				{
+					visit(current);
+				}
+			});
+		}
+		for (std::thread& worker : workers)
+		{
+			worker.join();
+		}
+	}
+
+	// Отделяет от цепочки start первые count узлов (или меньше, если цепочка короче).
+	// Возвращает голову остатка; у последнего отделённого узла next_node обнуляется
+	static Node* SplitChain(Node* start, size_t count) noexcept
+	{
+		for (size_t i = 1; start && i < count; ++i)
+		{
+			start = start->next_node;
+		}
+		if (!start)
+		{
+			return nullptr;
+		}
+		return std::exchange(start->next_node, nullptr);
+	}
+
+	// Сливает две отсортированные цепочки в одну, перешивая только указатели next_node.
+	// Возвращает голову и хвост получившейся цепочки
+	template <typename Comparator>
+	static std::pair<Node*, Node*> MergeChains(Node* a, Node* b, Comparator& comp)
+	{
+		Node* head = nullptr;
+		Node** link = &head;
+		Node* last = nullptr;
+		while (a && b)
+		{
+			// Берём b только если он строго меньше — так сортировка остаётся стабильной
+			if (comp(b->value, a->value))
+			{
+				*link = b;
+				b = b->next_node;
+			}
+			else
+			{
+				*link = a;
+				a = a->next_node;
+			}
+			last = *link;
+			link = &((*link)->next_node);
+		}
+		*link = (a) ? a : b;
+		// Дошагиваем до хвоста присоединённого остатка
+		for (Node* rest = *link; rest; rest = rest->next_node)
+		{
+			last = rest;
+		}
+		return {head, last};
+	}
 
 	//шаблонный метод для копирования узлов во временный список при инициализации через initializer_list и в конструкторе копирования
 
 	//не понял, а каким образом это можно сделать "не передавать и использовать как метод temp"? поясните, пожалуйста, что-то не соображу что именно надо сделать?
 	template <typename Container>
-	void CopyNodes(Container& container, SingleLinkedList& temp)
+	SLL_CONSTEXPR20 void CopyNodes(Container& container, SingleLinkedList& temp)
 	{
 		Iterator temp_current_node_addr(temp.before_begin());
 		for (auto& node : container)
@@ -192,13 +728,34 @@ public:
 
 public:
 
-	SingleLinkedList()
+	using allocator_type = Allocator;
+
+	SLL_CONSTEXPR20 SingleLinkedList()
 		:size_(0u)
 	{
 
 	}
 
-	SingleLinkedList(std::initializer_list<Type> values)
+	// Конструктор с явным аллокатором: все узлы списка будут выделяться через него
+	SLL_CONSTEXPR20 explicit SingleLinkedList(const Allocator& alloc)
+		: size_(0u)
+		, node_alloc_(alloc)
+	{
+
+	}
+
+	// Конструктор из пары итераторов [first, last).
+	// Второй шаблонный параметр отсекает не-итераторы, чтобы этот конструктор
+	// не перехватывал вызовы, предназначенные конструктору копирования
+	template <typename InputIterator, typename = typename std::iterator_traits<InputIterator>::iterator_category>
+	SLL_CONSTEXPR20 SingleLinkedList(InputIterator first, InputIterator last)
+		: size_(0u)
+	{
+		AssignRange(first, last);
+	}
+
+	SLL_CONSTEXPR20 SingleLinkedList(std::initializer_list<Type> values)
+		: size_(0u)
 	{
 		SingleLinkedList temp;
 		CopyNodes(values, temp);
@@ -213,20 +770,24 @@ public:
 	// - Когда временный список будет содержать копию исходного списка, останется использовать метод swap и обменять состояние текущего экземпляра 
 	//   класса и временного списка.
 
-	SingleLinkedList(const SingleLinkedList& other)
+	SLL_CONSTEXPR20 SingleLinkedList(const SingleLinkedList& other)
 		:size_(0u)
+		, node_alloc_(NodeAllocatorTraits::select_on_container_copy_construction(other.node_alloc_))
 	{
+		SLL_TRACE_SCOPE(ListTraceOp::kCopyConstruct);
 		//делаем проверку, что в этих переменных не лежат мусорные значения и разработчик не забыл их инициализировать при объявлении.
 		//если там все-таки есть какие-то значения, то это мусор и лучше упасть с ошибкой при помощи assert.
 		assert(size_ == 0 && head_.next_node == nullptr);
 
-		SingleLinkedList temp;
+		// Временный список использует тот же аллокатор, чтобы после swap узлы
+		// принадлежали аллокатору, выбранному select_on_container_copy_construction
+		SingleLinkedList temp{Allocator(node_alloc_)};
 		CopyNodes(other, temp);
 
 		swap(temp);
 	}
 
-	SingleLinkedList& operator=(const SingleLinkedList& rhs)
+	SLL_CONSTEXPR20 SingleLinkedList& operator=(const SingleLinkedList& rhs)
 	{
 		if (this != &rhs)
 		{
@@ -236,29 +797,65 @@ public:
 		return *this;
 	}
 
+	// Перемещающий конструктор. Забирает узлы other за O(1) — два обмена указателями,
+	// без копирования элементов. other остаётся валидным пустым списком
+	SLL_CONSTEXPR20 SingleLinkedList(SingleLinkedList&& other) noexcept
+		: size_(0u)
+	{
+		swap(other);
+	}
+
+	// Перемещающий оператор присваивания за O(1).
+	// Прежние узлы текущего списка освобождаются деструктором временного списка
+	SLL_CONSTEXPR20 SingleLinkedList& operator=(SingleLinkedList&& rhs) noexcept
+	{
+		if (this != &rhs)
+		{
+			SingleLinkedList temp(std::move(rhs));
+			swap(temp);
+		}
+		return *this;
+	}
+
 	// Обменивает содержимое списков за время O(1)
-	void swap(SingleLinkedList& other) noexcept
+	SLL_CONSTEXPR20 void swap(SingleLinkedList& other) noexcept
 	{
 		std::swap(this->size_, other.size_);
 		std::swap(this->head_.next_node, other.head_.next_node);
+		std::swap(this->tail_, other.tail_);
+		// Аллокатор обменивается вместе с узлами: каждый узел должен освобождаться
+		// тем же аллокатором, которым был выделен
+		std::swap(this->node_alloc_, other.node_alloc_);
+		// Кеш переработки путешествует вместе с аллокатором, которому принадлежат его блоки
+		std::swap(this->free_list_, other.free_list_);
+		std::swap(this->free_count_, other.free_count_);
+		std::swap(this->free_limit_, other.free_limit_);
+		if constexpr (EnableStats)
+		{
+			// Счётчики путешествуют вместе с узлами, которые они описывают
+			std::swap(this->stats_, other.stats_);
+		}
+		if constexpr (EnableDigest)
+		{
+			std::swap(this->digest_, other.digest_);
+			std::swap(this->digest_dirty_, other.digest_dirty_);
+		}
 	}
 
 	// Возвращает итератор, ссылающийся на первый элемент
 	// Если список пустой, возвращённый итератор будет равен end()
-	[[nodiscard]] Iterator begin() noexcept
+	[[nodiscard]] SLL_CONSTEXPR20 Iterator begin() noexcept
 	{
-		//если список не проинициализирован элементами, то необходимо вернуть пустой итератор
-		//без этого не сработают операции assert(++empty_list.before_begin() == empty_list.begin());, например
-		// 
-		// в этом ассерте список empty_list имеет size_ = 0; и при попытке вызвать empty_list.begin() поля итератора возвращаются вообще непроинициализированные ничем, судя по дебаггеру (вот такое возвращается: 0xcccccccc {head_={value=??? next_node=??? } size_=??? })
-		// если size_=0 то он вообще не пойму что возвращает в этом методе при работе если исключить возврат Iterator(), т.к. returna'а не будет вообще, он не войдет в единственное условие 
-		// поэтому нужна конструкция, кот. вернет итератор с проинициализированным полем node_ = nullptr, тогда его в ассерте корректно будет сравнить после инкрементирования before_begin(), там тоже будет nullptr
-		return (size_) ? Iterator(head_.next_node) : Iterator();
+		// У пустого списка head_.next_node == nullptr, поэтому итератор
+		// корректно равен end() без отдельной проверки size_. Проверка size_
+		// здесь и недопустима: begin() конкурентного читателя под ReadGuard
+		// гонялся бы с обновлением size_ в EraseAfterDeferred
+		return Iterator(AtomicLoadAcquire(&head_.next_node));
 	}
 
 	// Возвращает итератор, указывающий на позицию, следующую за последним элементом односвязного списка
 	// Разыменовывать этот итератор нельзя — попытка разыменования приведёт к неопределённому поведению
-	[[nodiscard]] Iterator end() noexcept
+	[[nodiscard]] SLL_CONSTEXPR20 Iterator end() noexcept
 	{
 		return Iterator();
 	}
@@ -266,66 +863,516 @@ public:
 	// Возвращает константный итератор, ссылающийся на первый элемент
 	// Если список пустой, возвращённый итератор будет равен end()
 	// Результат вызова эквивалентен вызову метода cbegin()
-	[[nodiscard]] ConstIterator begin() const noexcept
+	[[nodiscard]] SLL_CONSTEXPR20 ConstIterator begin() const noexcept
 	{
-		return (size_) ? ConstIterator(head_.next_node) : ConstIterator();
+		// См. неконстантный begin(): без обращения к size_, с acquire-загрузкой
+		return ConstIterator(AtomicLoadAcquire(&head_.next_node));
 	}
 
 	// Возвращает константный итератор, указывающий на позицию, следующую за последним элементом односвязного списка
 	// Разыменовывать этот итератор нельзя — попытка разыменования приведёт к неопределённому поведению
 	// Результат вызова эквивалентен вызову метода cend()
-	[[nodiscard]] ConstIterator end() const noexcept
+	[[nodiscard]] SLL_CONSTEXPR20 ConstIterator end() const noexcept
 	{
 		return ConstIterator();
 	}
 
 	// Возвращает константный итератор, ссылающийся на первый элемент
 	// Если список пустой, возвращённый итератор будет равен cend()
-	[[nodiscard]] ConstIterator cbegin() const noexcept
+	[[nodiscard]] SLL_CONSTEXPR20 ConstIterator cbegin() const noexcept
 	{
 		return begin(); //Константные методы можно реализовать через друг друга
 	}
 
 	// Возвращает константный итератор, указывающий на позицию, следующую за последним элементом односвязного списка
 	// Разыменовывать этот итератор нельзя — попытка разыменования приведёт к неопределённому поведению
-	[[nodiscard]] ConstIterator cend() const noexcept
+	[[nodiscard]] SLL_CONSTEXPR20 ConstIterator cend() const noexcept
 	{
 		return end(); //Константные методы можно реализовать через друг друга
 	}
 
 	// Вставляет элемент value в начало списка за время O(1)
-	void PushFront(const Type& value)
+	SLL_CONSTEXPR20 void PushFront(const Type& value)
 	{
-		this->head_.next_node = new Node(value, this->head_.next_node);
-		this->size_++;
+		EmplaceFront(value);
 	}
 
-	// Очищает список за время O(N)
-	void Clear() noexcept
+	// Вставляет элемент value в начало списка за время O(1), перемещая значение в узел
+	SLL_CONSTEXPR20 void PushFront(Type&& value)
+	{
+		EmplaceFront(std::move(value));
+	}
+
+	// Конструирует элемент в начале списка на месте из аргументов args за время O(1).
+	// Возвращает ссылку на созданный элемент
+	template <typename... Args>
+	SLL_CONSTEXPR20 reference EmplaceFront(Args&&... args)
 	{
-		while (this->head_.next_node) //Процесс очистки продолжается, пока список непустой — то есть указатель head_.next_node на первый элемент списка ненулевой.
+		this->head_.next_node = CreateNode(this->head_.next_node, std::forward<Args>(args)...);
+		this->size_++;
+		if (!this->tail_)
 		{
-			PopFront();
+			// Список был пуст — первый элемент одновременно и последний
+			this->tail_ = this->head_.next_node;
 		}
-		this->size_ = 0;
+		if constexpr (EnableStats)
+		{
+			++this->stats_.push_front_calls;
+		}
+		StatsOnSizeChanged();
+		DigestOnPushFront(this->head_.next_node->value);
+		return this->head_.next_node->value;
 	}
 
-	// Возвращает количество элементов в списке за время O(1)
-	[[nodiscard]] size_t GetSize() const noexcept
+	// Вставляет элемент value в конец списка за время O(1) благодаря кешированному tail_
+	SLL_CONSTEXPR20 void PushBack(const Type& value)
 	{
-		return size_;
+		EmplaceBack(value);
 	}
 
-	// Сообщает, пустой ли список за время O(1)
-	[[nodiscard]] bool IsEmpty() const noexcept
+	// Вставляет элемент value в конец списка за время O(1), перемещая значение в узел
+	SLL_CONSTEXPR20 void PushBack(Type&& value)
 	{
-		//return size_ ? false : true;
-		return size_ == 0;
+		EmplaceBack(std::move(value));
+	}
+
+	// Конструирует элемент в конце списка на месте из аргументов args за время O(1).
+	// Возвращает ссылку на созданный элемент
+	template <typename... Args>
+	SLL_CONSTEXPR20 reference EmplaceBack(Args&&... args)
+	{
+		Node* new_node = CreateNode(nullptr, std::forward<Args>(args)...);
+		if (this->tail_)
+		{
+			this->tail_->next_node = new_node;
+		}
+		else
+		{
+			this->head_.next_node = new_node;
+		}
+		this->tail_ = new_node;
+		this->size_++;
+		if constexpr (EnableStats)
+		{
+			++this->stats_.push_back_calls;
+		}
+		StatsOnSizeChanged();
+		DigestMarkDirty();
+		return new_node->value;
+	}
+
+	// Заменяет содержимое списка копиями элементов диапазона [first, last).
+	// Новая цепочка строится отдельно и подменяет старую одним swap:
+	// при исключении во время копирования список остаётся в прежнем состоянии
+	template <typename InputIterator>
+	SLL_CONSTEXPR20 void AssignRange(InputIterator first, InputIterator last)
+	{
+		SingleLinkedList temp{Allocator(node_alloc_)};
+		for (; first != last; ++first)
+		{
+			temp.PushBack(*first);
+		}
+		swap(temp);
+	}
+
+	/*
+	 * Вставляет копии элементов диапазона [first, last) после позиции pos.
+	 * Цепочка узлов строится отдельно от живого списка и вшивается одной перестановкой
+	 * указателей, поэтому при исключении список остаётся в прежнем состоянии.
+	 * Возвращает итератор на последний вставленный элемент (или pos для пустого диапазона)
+	 */
+	template <typename InputIterator>
+	Iterator InsertRangeAfter(ConstIterator pos, InputIterator first, InputIterator last)
+	{
+		if (!pos.node_)
+		{
+			throw std::invalid_argument("Невалидный аргумент: некорректный адрес узла (или адрес = nullptr) в методе InsertRangeAfter."s);
+		}
+
+		// Строим цепочку во временном списке ровно с тем же аллокатором узлов:
+		// ребинд-круг Allocator(node_alloc_) у нестандартного аллокатора может
+		// дать неравную копию с собственным пулом, и вшитые узлы пережили бы его
+		SingleLinkedList temp;
+		temp.node_alloc_ = node_alloc_;
+		for (; first != last; ++first)
+		{
+			temp.PushBack(*first);
+		}
+		if (temp.IsEmpty())
+		{
+			return Iterator(pos.node_);
+		}
+
+		// Вшиваем готовую цепочку за O(1)
+		Node* chain_first = temp.head_.next_node;
+		Node* chain_last = temp.tail_;
+		chain_last->next_node = pos.node_->next_node;
+		pos.node_->next_node = chain_first;
+		this->size_ += temp.size_;
+		if (chain_last->next_node == nullptr)
+		{
+			this->tail_ = chain_last;
+		}
+
+		// Временный список больше не владеет узлами
+		temp.head_.next_node = nullptr;
+		temp.tail_ = nullptr;
+		temp.size_ = 0;
+
+		return Iterator(chain_last);
+	}
+
+	/*
+	 * Перемещает все узлы other в текущий список после позиции pos за время O(1).
+	 * Элементы не копируются — перешиваются только указатели next_node.
+	 * other остаётся валидным пустым списком.
+	 * Списки должны использовать взаимозаменяемые (равные) аллокаторы
+	 */
+	void SpliceAfter(ConstIterator pos, SingleLinkedList&& other)
+	{
+		if (!pos.node_)
+		{
+			throw std::invalid_argument("Невалидный аргумент: некорректный адрес узла (или адрес = nullptr) в методе SpliceAfter."s);
+		}
+		assert(node_alloc_ == other.node_alloc_);
+		if (other.IsEmpty())
+		{
+			return;
+		}
+
+		Node* after = pos.node_->next_node;
+		pos.node_->next_node = other.head_.next_node;
+		other.tail_->next_node = after;
+		if (after == nullptr)
+		{
+			this->tail_ = other.tail_;
+		}
+		this->size_ += other.size_;
+
+		other.head_.next_node = nullptr;
+		other.tail_ = nullptr;
+		other.size_ = 0;
+		DigestMarkDirty();
+		other.DigestReset();
+	}
+
+	/*
+	 * Перемещает один узел other, следующий за элементом it, в текущий список после pos за O(1).
+	 * Аналог std::forward_list::splice_after для одного элемента
+	 */
+	void SpliceAfter(ConstIterator pos, SingleLinkedList& other, ConstIterator it)
+	{
+		if (!pos.node_ || !it.node_ || !it.node_->next_node)
+		{
+			throw std::invalid_argument("Невалидный аргумент: некорректный адрес узла (или адрес = nullptr) в методе SpliceAfter."s);
+		}
+		assert(node_alloc_ == other.node_alloc_);
+
+		Node* moved = it.node_->next_node;
+		// Вышиваем узел из other
+		it.node_->next_node = moved->next_node;
+		if (moved == other.tail_)
+		{
+			other.tail_ = (it.node_ == &other.head_) ? nullptr : it.node_;
+		}
+		--(other.size_);
+
+		// Вшиваем после pos
+		moved->next_node = pos.node_->next_node;
+		pos.node_->next_node = moved;
+		if (moved->next_node == nullptr)
+		{
+			this->tail_ = moved;
+		}
+		++(this->size_);
+		DigestMarkDirty();
+		other.DigestMarkDirty();
+	}
+
+	/*
+	 * Перемещает узлы диапазона (first, last) из other в текущий список после pos.
+	 * Сами перестановки указателей — O(1), но для поддержания size_ обоих списков за O(1)
+	 * диапазон один раз проходится для подсчёта перемещаемых узлов (O(длины диапазона));
+	 * тот же проход находит последний перемещаемый узел
+	 */
+	void SpliceAfter(ConstIterator pos, SingleLinkedList& other, ConstIterator first, ConstIterator last)
+	{
+		if (!pos.node_ || !first.node_)
+		{
+			throw std::invalid_argument("Невалидный аргумент: некорректный адрес узла (или адрес = nullptr) в методе SpliceAfter."s);
+		}
+		assert(node_alloc_ == other.node_alloc_);
+
+		// Единственный линейный проход: ищем последний узел диапазона и считаем длину
+		size_t count = 0;
+		Node* chain_last = first.node_;
+		while (chain_last->next_node != last.node_)
+		{
+			chain_last = chain_last->next_node;
+			++count;
+		}
+		if (count == 0)
+		{
+			return;
+		}
+		Node* chain_first = first.node_->next_node;
+
+		// Вышиваем цепочку из other
+		first.node_->next_node = last.node_;
+		if (chain_last == other.tail_)
+		{
+			other.tail_ = (first.node_ == &other.head_) ? nullptr : first.node_;
+		}
+		other.size_ -= count;
+
+		// Вшиваем цепочку после pos
+		chain_last->next_node = pos.node_->next_node;
+		pos.node_->next_node = chain_first;
+		if (chain_last->next_node == nullptr)
+		{
+			this->tail_ = chain_last;
+		}
+		this->size_ += count;
+		DigestMarkDirty();
+		other.DigestMarkDirty();
+	}
+
+	/*
+	 * Отделяет диапазон (first, last) с заранее известной вызывающему длиной count
+	 * и возвращает его самостоятельным списком с уже выставленными size_ и хвостом.
+	 * Проход ровно по count перемещаемым узлам нужен для обнуления связи последнего
+	 * из них, но пересчёта размеров нет: size_ обоих списков обновляется арифметикой
+	 * за O(1), поэтому GetSize()/IsEmpty() остаются дешёвыми.
+	 * Корректность count проверяется assert'ом в отладочной сборке
+	 */
+	SingleLinkedList ExtractAfter(ConstIterator first, ConstIterator last, size_t count)
+	{
+		if (!first.node_)
+		{
+			throw std::invalid_argument("Невалидный аргумент: некорректный адрес узла (или адрес = nullptr) в методе ExtractAfter."s);
+		}
+
+		// Результат несёт тот же аллокатор узлов, что и источник: усыновлённые
+		// узлы выделены им, и извлечённый список обязан уметь их освободить
+		// (и держать общий пул живым), даже пережив источник
+		SingleLinkedList result;
+		result.node_alloc_ = node_alloc_;
+		if (count == 0)
+		{
+			return result;
+		}
+
+		Node* chain_first = first.node_->next_node;
+		Node* chain_last = chain_first;
+		for (size_t i = 1; i < count; ++i)
+		{
+			assert(chain_last);
+			chain_last = chain_last->next_node;
+		}
+		assert(chain_last && chain_last->next_node == last.node_);
+
+		// Вышиваем цепочку из текущего списка
+		first.node_->next_node = chain_last->next_node;
+		chain_last->next_node = nullptr;
+		if (this->tail_ == chain_last)
+		{
+			this->tail_ = (first.node_ == &head_) ? nullptr : first.node_;
+		}
+		this->size_ -= count;
+		DigestMarkDirty();
+
+		result.AdoptChain(chain_first, chain_last, count);
+		return result;
+	}
+
+	/*
+	 * Счётная версия диапазонного SpliceAfter: перемещает диапазон (first, last)
+	 * известной длины count из other после pos. В отличие от несчётной версии
+	 * не тратит проход на подсчёт — размеры обоих списков обновляются за O(1)
+	 */
+	void SpliceAfter(ConstIterator pos, SingleLinkedList& other, ConstIterator first, ConstIterator last, size_t count)
+	{
+		SpliceAfter(pos, other.ExtractAfter(first, last, count));
+	}
+
+	// Присоединяет все узлы other в конец списка за время O(1) — одна сшивка указателей,
+	// без копирования элементов. other остаётся валидным пустым списком.
+	// Списки должны использовать взаимозаменяемые (равные) аллокаторы
+	void Append(SingleLinkedList&& other) noexcept
+	{
+		assert(node_alloc_ == other.node_alloc_);
+		if (other.IsEmpty())
+		{
+			return;
+		}
+		if (this->tail_)
+		{
+			this->tail_->next_node = other.head_.next_node;
+		}
+		else
+		{
+			this->head_.next_node = other.head_.next_node;
+		}
+		this->tail_ = other.tail_;
+		this->size_ += other.size_;
+
+		other.head_.next_node = nullptr;
+		other.tail_ = nullptr;
+		other.size_ = 0;
+		DigestMarkDirty();
+		other.DigestReset();
+	}
+
+	// Очищает список за время O(N).
+	// Если тип тривиально разрушаем, аллокатор умеет ReleaseAll() (как PoolAllocator)
+	// и этот список — единственный владелец пула, все узлы возвращаются пулу разом
+	// за O(1) вместо поузлового обхода. При разделённом пуле (копии и rebind-копии
+	// аллокатора видят один пул) массовый сброс задел бы чужие живые узлы,
+	// поэтому такие списки очищаются поузлово
+	SLL_CONSTEXPR20 void Clear() noexcept
+	{
+		SLL_TRACE_SCOPE(ListTraceOp::kClear);
+		if constexpr (std::is_trivially_destructible_v<Type>
+			&& AllocatorHasReleaseAll<NodeAllocator>::value
+			&& AllocatorHasExclusiveOwnershipCheck<NodeAllocator>::value)
+		{
+			if (node_alloc_.OwnsPoolExclusively())
+			{
+				node_alloc_.ReleaseAll();
+				this->head_.next_node = nullptr;
+				// ReleaseAll вернул пулу и блоки кеша переработки — цепочка кеша недействительна
+				this->free_list_ = nullptr;
+				this->free_count_ = 0;
+			}
+			else
+			{
+				DestroyChain(std::exchange(this->head_.next_node, nullptr));
+			}
+		}
+		else
+		{
+			// Цепочка отсоединяется одним обменом и разрушается тесным циклом —
+			// без поузловых обновлений size_ и tail_, которые делал бы PopFront
+			DestroyChain(std::exchange(this->head_.next_node, nullptr));
+		}
+		this->size_ = 0;
+		this->tail_ = nullptr;
+		DigestReset();
+	}
+
+	/*
+	 * Асинхронная очистка для списков на горячем пути запросов: цепочка
+	 * отсоединяется за O(1) (один обмен указателя и сброс размера), после чего
+	 * список сразу пуст и пригоден к использованию, а узлы освобождает единый
+	 * фоновый поток ListAsyncReclaimer (дождаться фоновых деструкторов можно
+	 * через ListAsyncReclaimer::Instance().Flush()). Кеш переработки
+	 * не пополняется — узлы уходят аллокатору напрямую.
+	 * Как и EraseAfterDeferred, поддерживается только для std::allocator:
+	 * фоновое освобождение выполняется через delete
+	 */
+	void ClearAsync()
+	{
+		static_assert(std::is_same_v<Allocator, std::allocator<Type>>,
+			"ClearAsync поддерживается только для std::allocator: фоновое освобождение выполняется через delete");
+
+		Node* detached = std::exchange(this->head_.next_node, nullptr);
+		this->size_ = 0;
+		this->tail_ = nullptr;
+		DigestReset();
+		if (!detached)
+		{
+			return;
+		}
+
+		ListAsyncReclaimer::Instance().Submit([detached]()
+		{
+			Node* node = detached;
+			while (node)
+			{
+				delete std::exchange(node, node->next_node);
+			}
+		});
+	}
+
+	// Возвращает количество элементов в списке за время O(1)
+	[[nodiscard]] SLL_CONSTEXPR20 size_t GetSize() const noexcept
+	{
+		return size_;
+	}
+
+	// Сообщает, пустой ли список за время O(1)
+	[[nodiscard]] SLL_CONSTEXPR20 bool IsEmpty() const noexcept
+	{
+		//return size_ ? false : true;
+		return size_ == 0;
+	}
+
+	// Возвращает снимок счётчиков инструментирования.
+	// Доступен только для списков, собранных с EnableStats = true;
+	// у обычных списков метод не инстанцируется и памяти под счётчики нет
+	[[nodiscard]] ListStats GetStats() const noexcept
+	{
+		static_assert(EnableStats,
+			"GetStats доступен только при EnableStats = true");
+		ListStats snapshot = this->stats_;
+		snapshot.bytes_held = size_ * sizeof(Node);
+		return snapshot;
+	}
+
+	/*
+	 * Возвращает порядкозависимый дайджест содержимого (см. параметр EnableDigest).
+	 * Актуальный кеш отдаётся за O(1); после мутаций, не обновляющих дайджест
+	 * инкрементально, выполняется ленивый пересчёт за O(N).
+	 * Равные списки всегда имеют равный дайджест; обратное верно с точностью
+	 * до коллизий хеша, поэтому совпадение дайджестов — не доказательство равенства
+	 */
+	[[nodiscard]] uint64_t GetDigest() const
+	{
+		static_assert(EnableDigest,
+			"GetDigest доступен только при EnableDigest = true");
+		if (this->digest_dirty_)
+		{
+			uint64_t digest = 0;
+			uint64_t power = 1;
+			for (const Node* node = head_.next_node; node; node = node->next_node)
+			{
+				digest += std::hash<Type>{}(node->value) * power;
+				power *= kDigestPrime;
+			}
+			this->digest_ = digest;
+			this->digest_dirty_ = false;
+		}
+		return this->digest_;
+	}
+
+	/*
+	 * Включает переработку узлов: до limit разрушенных узлов не возвращаются
+	 * аллокатору, а ждут в кеше и переиспользуются ближайшими вставками —
+	 * на нагрузках «удалили тысячи, вставили тысячи» путь через malloc
+	 * превращается в пару перестановок указателей. При уменьшении предела
+	 * лишние блоки возвращаются аллокатору сразу; limit = 0 выключает кеш
+	 */
+	void SetNodeCacheLimit(size_t limit) noexcept
+	{
+		free_limit_ = limit;
+		ReleaseCachedNodes(limit);
+	}
+
+	// Текущее число узлов в кеше переработки (для диагностики и тестов)
+	[[nodiscard]] size_t GetNodeCacheSize() const noexcept
+	{
+		return free_count_;
+	}
+
+	// Возвращает аллокатору все блоки кеша переработки; предел кеша сохраняется
+	SLL_CONSTEXPR20 void ShrinkToFit() noexcept
+	{
+		ReleaseCachedNodes(0);
 	}
 
 	// Возвращает итератор, указывающий на позицию перед первым элементом односвязного списка.
 	// Разыменовывать этот итератор нельзя - попытка разыменования приведёт к неопределённому поведению
-	[[nodiscard]] Iterator before_begin() noexcept
+	[[nodiscard]] SLL_CONSTEXPR20 Iterator before_begin() noexcept
 	{
 		Iterator temp(&head_);
 		return temp;
@@ -333,7 +1380,7 @@ public:
 
 	// Возвращает константный итератор, указывающий на позицию перед первым элементом односвязного списка.
 	// Разыменовывать этот итератор нельзя - попытка разыменования приведёт к неопределённому поведению
-	[[nodiscard]] ConstIterator cbefore_begin() const noexcept
+	[[nodiscard]] SLL_CONSTEXPR20 ConstIterator cbefore_begin() const noexcept
 	{
 		ConstIterator temp(const_cast<Node*>(&head_));
 		return temp;
@@ -341,7 +1388,7 @@ public:
 
 	// Возвращает константный итератор, указывающий на позицию перед первым элементом односвязного списка.
 	// Разыменовывать этот итератор нельзя - попытка разыменования приведёт к неопределённому поведению
-	[[nodiscard]] ConstIterator before_begin() const noexcept
+	[[nodiscard]] SLL_CONSTEXPR20 ConstIterator before_begin() const noexcept
 	{
 		ConstIterator temp(const_cast<Node*>(&head_)); //const_cast<Node*>
 		return temp;
@@ -352,107 +1399,1106 @@ public:
 	 * Возвращает итератор на вставленный элемент
 	 * Если при создании элемента будет выброшено исключение, список останется в прежнем состоянии
 	 */
-	Iterator InsertAfter(ConstIterator pos, const Type& value)
+	SLL_CONSTEXPR20 Iterator InsertAfter(ConstIterator pos, const Type& value)
+	{
+		return EmplaceAfter(pos, value);
+	}
+
+	/*
+	 * Вставляет элемент value после элемента, на который указывает pos, перемещая значение в узел.
+	 * Возвращает итератор на вставленный элемент
+	 */
+	SLL_CONSTEXPR20 Iterator InsertAfter(ConstIterator pos, Type&& value)
+	{
+		return EmplaceAfter(pos, std::move(value));
+	}
+
+	/*
+	 * Конструирует элемент на месте из аргументов args после элемента, на который указывает pos.
+	 * Возвращает итератор на вставленный элемент
+	 * Если при создании элемента будет выброшено исключение, список останется в прежнем состоянии
+	 */
+	template <typename... Args>
+	SLL_CONSTEXPR20 Iterator EmplaceAfter(ConstIterator pos, Args&&... args)
 	{
-		if (pos.node_)
+		SLL_TRACE_SCOPE(ListTraceOp::kInsertAfter);
+		if constexpr (Checked)
 		{
-			Node* new_node = new Node(value, pos.node_->next_node);
-			pos.node_->next_node = new_node;
+			if (!pos.node_)
+			{
+				//здесь получается можно оставить? или лучше уже однообразно везде asser(false)?
+				throw std::invalid_argument("Невалидный аргумент: некорректный адрес узла (или адрес = nullptr) в методе InsertAfter."s); //перебрасываем
+			}
+		}
 
-			++(this->size_);
+		Node* new_node = CreateNode(pos.node_->next_node, std::forward<Args>(args)...);
+		pos.node_->next_node = new_node;
 
-			return Iterator(new_node);
+		++(this->size_);
+
+		if (new_node->next_node == nullptr)
+		{
+			// Вставка за последним элементом (или в пустой список) — новый узел становится хвостом
+			this->tail_ = new_node;
 		}
-		else
+
+		if constexpr (EnableStats)
 		{
-			//здесь получается можно оставить? или лучше уже однообразно везде asser(false)?
-			throw std::invalid_argument("Невалидный аргумент: некорректный адрес узла (или адрес = nullptr) в методе InsertAfter."s); //перебрасываем
+			++this->stats_.insert_after_calls;
 		}
+		StatsOnSizeChanged();
+		DigestMarkDirty();
+
+		return Iterator(new_node);
 	}
 
-	void PopFront() noexcept
+	// Удаляет все элементы, равные value, за один проход по списку.
+	// Возвращает количество удалённых элементов
+	size_t Remove(const Type& value)
 	{
-		if (head_.next_node)
+		return RemoveIf([&value](const Type& element)
 		{
-			delete std::exchange(this->head_.next_node, this->head_.next_node->next_node);
+			return element == value;
+		});
+	}
 
-			--(this->size_);
+	// Удаляет все элементы, для которых pred(элемент) истинен, за один проход:
+	// узлы вышиваются на месте, значения не копируются и не перемещаются.
+	// Возвращает количество удалённых элементов
+	template <typename Predicate>
+	size_t RemoveIf(Predicate pred)
+	{
+		size_t removed = 0;
+		Node* prev = &head_;
+		while (prev->next_node)
+		{
+			// size_ и tail_ обновляются по мере отцепления узлов: если pred бросит
+			// исключение посреди прохода, список останется согласованным —
+			// уже удалённые узлы не будут числиться в размере
+			if (pred(prev->next_node->value))
+			{
+				DestroyNode(std::exchange(prev->next_node, prev->next_node->next_node));
+				--(this->size_);
+				++removed;
+				if (prev->next_node == nullptr)
+				{
+					// Удалён последний узел — хвостом становится prev
+					// (или список опустел, если prev — фиктивный узел)
+					this->tail_ = (prev == &head_) ? nullptr : prev;
+				}
+				DigestMarkDirty();
+			}
+			else
+			{
+				prev = prev->next_node;
+			}
 		}
-		else
+		return removed;
+	}
+
+	// Удаляет подряд идущие одинаковые элементы, оставляя по одному из каждой серии.
+	// Возвращает количество удалённых элементов
+	size_t Unique()
+	{
+		size_t removed = 0;
+		Node* current = head_.next_node;
+		while (current && current->next_node)
+		{
+			if (current->next_node->value == current->value)
+			{
+				DestroyNode(std::exchange(current->next_node, current->next_node->next_node));
+				++removed;
+			}
+			else
+			{
+				current = current->next_node;
+			}
+		}
+		if (current)
 		{
-			assert(false);
+			this->tail_ = current;
 		}
+		this->size_ -= removed;
+		if (removed)
+		{
+			DigestMarkDirty();
+		}
+		return removed;
 	}
 
 	/*
-	 * Удаляет элемент, следующий за pos.
-	 * Возвращает итератор на элемент, следующий за удалённым
+	 * Обходит список и вызывает func для каждого элемента, программно подтягивая в кеш
+	 * узел на prefetch_distance позиций вперёд. Второй указатель идёт с опережением,
+	 * поэтому загрузка будущих узлов перекрывается с обработкой текущих — на сканирующих
+	 * нагрузках это прячет значительную часть промахов кеша, неизбежных
+	 * при позвенном обходе через operator++
 	 */
-	Iterator EraseAfter(ConstIterator pos) noexcept
+	template <typename Function>
+	void ForEach(Function func, size_t prefetch_distance = 8u)
 	{
-		if (pos.node_)
+		SLL_TRACE_SCOPE(ListTraceOp::kTraverse);
+		// func получает изменяемые ссылки — кешированный дайджест может устареть
+		DigestMarkDirty();
+		// Разгоняем опережающий указатель
+		const Node* ahead = head_.next_node;
+		for (size_t i = 0; ahead && i < prefetch_distance; ++i)
 		{
-			delete std::exchange(pos.node_->next_node, pos.node_->next_node->next_node);
-			--(this->size_);
+			ahead = ahead->next_node;
+		}
+		for (Node* node = head_.next_node; node; node = node->next_node)
+		{
+			if (ahead)
+			{
+				PrefetchForRead(ahead);
+				ahead = ahead->next_node;
+			}
+			func(node->value);
+		}
+	}
 
-			return Iterator(pos.node_->next_node);
+	// Константная версия ForEach: func получает const-ссылки на элементы
+	template <typename Function>
+	void ForEach(Function func, size_t prefetch_distance = 8u) const
+	{
+		SLL_TRACE_SCOPE(ListTraceOp::kTraverse);
+		const Node* ahead = head_.next_node;
+		for (size_t i = 0; ahead && i < prefetch_distance; ++i)
+		{
+			ahead = ahead->next_node;
 		}
-		else
+		for (const Node* node = head_.next_node; node; node = node->next_node)
 		{
-			assert(false);
+			if (ahead)
+			{
+				PrefetchForRead(ahead);
+				ahead = ahead->next_node;
+			}
+			func(node->value);
 		}
 	}
 
-	~SingleLinkedList()
+	// Находит первый элемент, равный value. Возвращает end(), если такого нет.
+	// Классическая позвенная раскладка не даёт векторизоваться — O(N) погонь за указателем
+	[[nodiscard]] Iterator Find(const Type& value) noexcept
 	{
-		Clear();
+		for (Node* node = head_.next_node; node; node = node->next_node)
+		{
+			if (node->value == value)
+			{
+				return Iterator(node);
+			}
+		}
+		return end();
 	}
 
-};
+	[[nodiscard]] ConstIterator Find(const Type& value) const noexcept
+	{
+		for (Node* node = head_.next_node; node; node = node->next_node)
+		{
+			if (node->value == value)
+			{
+				return ConstIterator(node);
+			}
+		}
+		return end();
+	}
 
-template <typename Type>
-void swap(SingleLinkedList<Type>& lhs, SingleLinkedList<Type>& rhs) noexcept
-{
-	lhs.swap(rhs);
-}
+	// Подсчитывает элементы, равные value, за один проход
+	[[nodiscard]] size_t Count(const Type& value) const noexcept
+	{
+		size_t result = 0;
+		for (const Node* node = head_.next_node; node; node = node->next_node)
+		{
+			if (node->value == value)
+			{
+				++result;
+			}
+		}
+		return result;
+	}
 
-template <typename Type>
-bool operator==(const SingleLinkedList<Type>& lhs, const SingleLinkedList<Type>& rhs)
-{
-	if (&lhs != &rhs)
-		return std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
-	else
-		return true;
-}
+	// Свёртка списка: последовательно применяет acc = op(acc, элемент)
+	template <typename Accum, typename Operation>
+	[[nodiscard]] Accum Accumulate(Accum init, Operation op) const
+	{
+		for (const Node* node = head_.next_node; node; node = node->next_node)
+		{
+			init = op(std::move(init), node->value);
+		}
+		return init;
+	}
 
-template <typename Type>
-bool operator!=(const SingleLinkedList<Type>& lhs, const SingleLinkedList<Type>& rhs)
+	/*
+	 * Обходит список пакетами: сначала собирает адреса batch_size узлов
+	 * (подтягивая каждый следующий в кеш), затем вызывает func для собранного пакета.
+	 * Подходит, когда func достаточно тяжёлая, чтобы за время её работы
+	 * префетчи следующего пакета успели дойти до памяти
+	 */
+	template <typename Function>
+	void ForEachBatch(Function func, size_t batch_size = 16u) const
+	{
+		constexpr size_t kMaxBatch = 64u;
+		if (batch_size > kMaxBatch)
+		{
+			batch_size = kMaxBatch;
+		}
+		if (batch_size == 0)
+		{
+			batch_size = 1;
+		}
+
+		const Node* batch[kMaxBatch];
+		const Node* node = head_.next_node;
+		while (node)
+		{
+			size_t collected = 0;
+			while (node && collected < batch_size)
+			{
+				batch[collected] = node;
+				node = node->next_node;
+				if (node)
+				{
+					PrefetchForRead(node);
+				}
+				++collected;
+			}
+			for (size_t i = 0; i < collected; ++i)
+			{
+				func(batch[i]->value);
+			}
+		}
+	}
+
+	/*
+	 * Параллельный обход: список один раз делится на num_threads примерно равных
+	 * сегментов (size_ известен, поэтому границы находятся за один проход по цепочке),
+	 * после чего каждый сегмент обходится своим потоком. func вызывается с const-ссылкой
+	 * на элемент и обязана быть потокобезопасной относительно самой себя; список
+	 * на время обхода модифицировать нельзя. Подготовительный проход — O(N),
+	 * но тело обхода распараллеливается целиком, что окупается на больших
+	 * списках с нетривиальной func
+	 */
+	template <typename Function>
+	void ParallelForEach(Function func, size_t num_threads) const
+	{
+		ParallelWalk(head_.next_node, size_, num_threads, [&func](const Node* node)
+		{
+			func(node->value);
+		});
+	}
+
+	// Параллельная версия с изменяемыми элементами: func получает Type&.
+	// Сегменты не пересекаются, поэтому гонок по элементам нет
+	template <typename Function>
+	void ParallelForEach(Function func, size_t num_threads)
+	{
+		// func получает изменяемые ссылки — кешированный дайджест может устареть
+		DigestMarkDirty();
+		ParallelWalk(head_.next_node, size_, num_threads, [&func](const Node* node)
+		{
+			func(const_cast<Node*>(node)->value);
+		});
+	}
+
+	// Параллельно заменяет каждый элемент на func(элемент) — преобразование на месте
+	// по тем же непересекающимся сегментам, что и ParallelForEach
+	template <typename Function>
+	void ParallelTransform(Function func, size_t num_threads)
+	{
+		ParallelForEach([&func](Type& value)
+		{
+			value = func(value);
+		}, num_threads);
+	}
+
+	// Разворачивает список на месте за O(N) времени и O(1) дополнительной памяти:
+	// перешиваются только указатели next_node, значения не трогаются
+	void Reverse() noexcept
+	{
+		Node* prev = nullptr;
+		Node* current = head_.next_node;
+		this->tail_ = head_.next_node;
+		while (current)
+		{
+			Node* next = current->next_node;
+			current->next_node = prev;
+			prev = current;
+			current = next;
+		}
+		head_.next_node = prev;
+		DigestMarkDirty();
+	}
+
+	// Сортирует список на месте восходящей (bottom-up) сортировкой слиянием:
+	// O(N log N) сравнений, O(1) дополнительной памяти, без копирования и перемещения значений —
+	// узлы только перешиваются. Сортировка стабильна
+	template <typename Comparator>
+	void Sort(Comparator comp)
+	{
+		if (this->size_ < 2u)
+		{
+			return;
+		}
+		// На каждом проходе сливаем пары соседних отсортированных серий длины width
+		for (size_t width = 1; width < this->size_; width *= 2)
+		{
+			Node* remaining = head_.next_node;
+			Node* new_head = nullptr;
+			Node** link = &new_head;
+			Node* new_tail = nullptr;
+			while (remaining)
+			{
+				Node* a = remaining;
+				Node* b = SplitChain(a, width);
+				remaining = SplitChain(b, width);
+				const auto merged = MergeChains(a, b, comp);
+				*link = merged.first;
+				new_tail = merged.second;
+				link = &(new_tail->next_node);
+			}
+			head_.next_node = new_head;
+			this->tail_ = new_tail;
+		}
+		DigestMarkDirty();
+	}
+
+	// Сортирует список по возрастанию (operator<)
+	void Sort()
+	{
+		Sort([](const Type& lhs, const Type& rhs)
+		{
+			return lhs < rhs;
+		});
+	}
+
+	/*
+	 * Сливает отсортированный список other в текущий (тоже отсортированный) с сохранением порядка.
+	 * Узлы other перешиваются в текущую цепочку без копирования значений; other остаётся пустым.
+	 * Списки должны использовать взаимозаменяемые (равные) аллокаторы
+	 */
+	template <typename Comparator>
+	void Merge(SingleLinkedList&& other, Comparator comp)
+	{
+		assert(node_alloc_ == other.node_alloc_);
+		if (other.IsEmpty())
+		{
+			return;
+		}
+
+		const auto merged = MergeChains(head_.next_node, other.head_.next_node, comp);
+		head_.next_node = merged.first;
+		this->tail_ = merged.second;
+		this->size_ += other.size_;
+
+		other.head_.next_node = nullptr;
+		other.tail_ = nullptr;
+		other.size_ = 0;
+		DigestMarkDirty();
+		other.DigestReset();
+	}
+
+	// Сливает отсортированный список other в текущий по возрастанию (operator<)
+	void Merge(SingleLinkedList&& other)
+	{
+		Merge(std::move(other), [](const Type& lhs, const Type& rhs)
+		{
+			return lhs < rhs;
+		});
+	}
+
+	SLL_CONSTEXPR20 void PopFront() noexcept
+	{
+		if constexpr (Checked)
+		{
+			if (!head_.next_node)
+			{
+				assert(false);
+			}
+		}
+
+		DestroyNode(std::exchange(this->head_.next_node, this->head_.next_node->next_node));
+
+		--(this->size_);
+
+		if (this->head_.next_node == nullptr)
+		{
+			this->tail_ = nullptr;
+		}
+
+		if constexpr (EnableStats)
+		{
+			++this->stats_.pop_front_calls;
+		}
+		DigestMarkDirty();
+	}
+
+	/*
+	 * Удаляет элемент, следующий за pos.
+	 * Возвращает итератор на элемент, следующий за удалённым
+	 */
+	SLL_CONSTEXPR20 Iterator EraseAfter(ConstIterator pos) noexcept
+	{
+		SLL_TRACE_SCOPE(ListTraceOp::kEraseAfter);
+		if constexpr (Checked)
+		{
+			if (!pos.node_)
+			{
+				assert(false);
+			}
+		}
+
+		DestroyNode(std::exchange(pos.node_->next_node, pos.node_->next_node->next_node));
+		--(this->size_);
+
+		if (pos.node_->next_node == nullptr)
+		{
+			// Удалён последний элемент — хвостом становится pos
+			// (либо список опустел, если pos указывает на фиктивный узел)
+			this->tail_ = (pos.node_ == &head_) ? nullptr : pos.node_;
+		}
+
+		if constexpr (EnableStats)
+		{
+			++this->stats_.erase_after_calls;
+		}
+		DigestMarkDirty();
+
+		return Iterator(pos.node_->next_node);
+	}
+
+	/*
+	 * Записывает список в поток в бинарном виде: uint64_t-префикс с количеством элементов,
+	 * затем побайтовые образы элементов подряд. Элементы копируются в буфер и пишутся
+	 * блоками ~4 КБ, а не по одному вызову на элемент — на больших списках это убирает
+	 * почти все обращения к потоку. Только для тривиально копируемых типов.
+	 * При ошибке потока бросает std::runtime_error
+	 */
+	void Serialize(std::ostream& out) const
+	{
+		static_assert(std::is_trivially_copyable_v<Type>,
+			"Serialize поддерживает только тривиально копируемые типы");
+
+		const uint64_t count = this->size_;
+		out.write(reinterpret_cast<const char*>(&count), sizeof(count));
+
+		// Буфер на ~4 КБ, выровненный под Type
+		constexpr size_t kBufferElements = (sizeof(Type) >= 4096u) ? 1u : (4096u / sizeof(Type));
+		alignas(Type) unsigned char buffer[kBufferElements * sizeof(Type)];
+		size_t filled = 0;
+
+		for (const Node* node = head_.next_node; node; node = node->next_node)
+		{
+			std::memcpy(buffer + filled * sizeof(Type), &node->value, sizeof(Type));
+			++filled;
+			if (filled == kBufferElements)
+			{
+				out.write(reinterpret_cast<const char*>(buffer), filled * sizeof(Type));
+				filled = 0;
+			}
+		}
+		if (filled > 0)
+		{
+			out.write(reinterpret_cast<const char*>(buffer), filled * sizeof(Type));
+		}
+
+		if (!out)
+		{
+			throw std::runtime_error("Ошибка записи потока в методе Serialize."s);
+		}
+	}
+
+	/*
+	 * Восстанавливает список из потока, записанного методом Serialize.
+	 * Читает элементы блоками и строит новую цепочку отдельно от текущего списка,
+	 * поэтому при ошибке чтения список остаётся в прежнем состоянии.
+	 * При ошибке или усечённом потоке бросает std::runtime_error
+	 */
+	void Deserialize(std::istream& in)
+	{
+		static_assert(std::is_trivially_copyable_v<Type>,
+			"Deserialize поддерживает только тривиально копируемые типы");
+
+		uint64_t count = 0;
+		in.read(reinterpret_cast<char*>(&count), sizeof(count));
+		if (!in)
+		{
+			throw std::runtime_error("Ошибка чтения префикса размера в методе Deserialize."s);
+		}
+
+		SingleLinkedList temp{Allocator(node_alloc_)};
+
+		constexpr size_t kBufferElements = (sizeof(Type) >= 4096u) ? 1u : (4096u / sizeof(Type));
+		alignas(Type) unsigned char buffer[kBufferElements * sizeof(Type)];
+
+		uint64_t remaining = count;
+		while (remaining > 0)
+		{
+			const size_t batch = (remaining < kBufferElements) ? static_cast<size_t>(remaining) : kBufferElements;
+			in.read(reinterpret_cast<char*>(buffer), batch * sizeof(Type));
+			if (!in)
+			{
+				throw std::runtime_error("Усечённый или повреждённый поток в методе Deserialize."s);
+			}
+			const Type* values = reinterpret_cast<const Type*>(buffer);
+			for (size_t i = 0; i < batch; ++i)
+			{
+				temp.PushBack(values[i]);
+			}
+			remaining -= batch;
+		}
+
+		swap(temp);
+	}
+
+	/*
+	 * Удаляет элемент, следующий за pos, откладывая освобождение узла через домен
+	 * эпохального освобождения (см. epoch-reclamation.h): узел вышивается из цепочки
+	 * немедленно, но физически удаляется только после выхода всех читателей,
+	 * обходящих список под ReadGuard. Требуется duck-типизированный domain
+	 * с методом Retire(Node*). Работает для списков со std::allocator —
+	 * отложенное удаление выполняется обычным delete.
+	 * Возвращает итератор на элемент, следующий за удалённым
+	 */
+	template <typename ReclamationDomain>
+	Iterator EraseAfterDeferred(ConstIterator pos, ReclamationDomain& domain) noexcept
+	{
+		static_assert(std::is_same_v<Allocator, std::allocator<Type>>,
+			"EraseAfterDeferred поддерживается только для std::allocator: отложенное удаление выполняется через delete");
+		if constexpr (Checked)
+		{
+			if (!pos.node_)
+			{
+				assert(false);
+				return Iterator();
+			}
+		}
+
+		// Перешитая ссылка публикуется release-записью: конкурентные читатели
+		// под ReadGuard загружают её acquire-инкрементом итератора и видят либо
+		// старую, либо новую цепочку целиком — без гонки данных
+		Node* removed = pos.node_->next_node;
+		AtomicStoreRelease(&pos.node_->next_node, removed->next_node);
+		--(this->size_);
+
+		if (pos.node_->next_node == nullptr)
+		{
+			this->tail_ = (pos.node_ == &head_) ? nullptr : pos.node_;
+		}
+
+		// Узел уже недостижим для новых читателей; старых переживёт домен
+		domain.Retire(removed);
+
+		if constexpr (EnableStats)
+		{
+			++this->stats_.erase_after_calls;
+		}
+		DigestMarkDirty();
+
+		return Iterator(pos.node_->next_node);
+	}
+
+	SLL_CONSTEXPR20 ~SingleLinkedList()
+	{
+		Clear();
+		ShrinkToFit();
+	}
+
+};
+
+template <typename Type, typename Allocator, bool EnableStats, bool Checked, bool EnableDigest>
+SLL_CONSTEXPR20 void swap(SingleLinkedList<Type, Allocator, EnableStats, Checked, EnableDigest>& lhs, SingleLinkedList<Type, Allocator, EnableStats, Checked, EnableDigest>& rhs) noexcept
+{
+	lhs.swap(rhs);
+}
+
+template <typename Type, typename Allocator, bool EnableStats, bool Checked, bool EnableDigest>
+SLL_CONSTEXPR20 bool operator==(const SingleLinkedList<Type, Allocator, EnableStats, Checked, EnableDigest>& lhs, const SingleLinkedList<Type, Allocator, EnableStats, Checked, EnableDigest>& rhs)
+{
+	if (&lhs != &rhs)
+	{
+		// Быстрый отказ по размеру и кешированному дайджесту:
+		// несовпадающие списки отклоняются без обхода цепочек
+		if (lhs.GetSize() != rhs.GetSize())
+		{
+			return false;
+		}
+		if constexpr (EnableDigest)
+		{
+			if (lhs.GetDigest() != rhs.GetDigest())
+			{
+				return false;
+			}
+		}
+		return std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+	}
+	else
+		return true;
+}
+
+template <typename Type, typename Allocator, bool EnableStats, bool Checked, bool EnableDigest>
+SLL_CONSTEXPR20 bool operator!=(const SingleLinkedList<Type, Allocator, EnableStats, Checked, EnableDigest>& lhs, const SingleLinkedList<Type, Allocator, EnableStats, Checked, EnableDigest>& rhs)
 {
 	return (!(lhs == rhs));
 }
 
-template <typename Type>
-bool operator<(const SingleLinkedList<Type>& lhs, const SingleLinkedList<Type>& rhs) {
+template <typename Type, typename Allocator, bool EnableStats, bool Checked, bool EnableDigest>
+SLL_CONSTEXPR20 bool operator<(const SingleLinkedList<Type, Allocator, EnableStats, Checked, EnableDigest>& lhs, const SingleLinkedList<Type, Allocator, EnableStats, Checked, EnableDigest>& rhs) {
 	if (&lhs != &rhs)
 		return std::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
 	else
 		return false;
 }
 
-template <typename Type>
-bool operator<=(const SingleLinkedList<Type>& lhs, const SingleLinkedList<Type>& rhs)
+template <typename Type, typename Allocator, bool EnableStats, bool Checked, bool EnableDigest>
+SLL_CONSTEXPR20 bool operator<=(const SingleLinkedList<Type, Allocator, EnableStats, Checked, EnableDigest>& lhs, const SingleLinkedList<Type, Allocator, EnableStats, Checked, EnableDigest>& rhs)
 {
-	return (!(lhs < rhs)) ? true : false;
+	return !(rhs < lhs);
 }
 
-template <typename Type>
-bool operator>(const SingleLinkedList<Type>& lhs, const SingleLinkedList<Type>& rhs)
+template <typename Type, typename Allocator, bool EnableStats, bool Checked, bool EnableDigest>
+SLL_CONSTEXPR20 bool operator>(const SingleLinkedList<Type, Allocator, EnableStats, Checked, EnableDigest>& lhs, const SingleLinkedList<Type, Allocator, EnableStats, Checked, EnableDigest>& rhs)
 {
-	return (lhs <= rhs);
+	return rhs < lhs;
 }
 
-template <typename Type>
-bool operator>=(const SingleLinkedList<Type>& lhs, const SingleLinkedList<Type>& rhs)
+template <typename Type, typename Allocator, bool EnableStats, bool Checked, bool EnableDigest>
+SLL_CONSTEXPR20 bool operator>=(const SingleLinkedList<Type, Allocator, EnableStats, Checked, EnableDigest>& lhs, const SingleLinkedList<Type, Allocator, EnableStats, Checked, EnableDigest>& rhs)
+{
+	return !(lhs < rhs);
+}
+
+#if defined(__cpp_constexpr_dynamic_alloc) && __cpp_constexpr_dynamic_alloc >= 201907L
+
+/*
+ * Consteval-строитель статических таблиц: build() строит список на этапе
+ * компиляции, а его содержимое замораживается в плоский std::array из N
+ * элементов. Динамические узлы не переживают константное вычисление,
+ * поэтому итог — непрерывный статический образ, который линкер кладёт
+ * в read-only страницы, разделяемые между процессами; рантайм-построение
+ * цепочки на старте исчезает целиком.
+ * N должно совпадать с размером построенного списка
+ */
+template <size_t N, typename Builder>
+consteval auto FreezeListToArray(Builder build)
+{
+	auto list = build();
+	static_assert(N > 0u, "FreezeListToArray: массив не может быть пустым");
+	std::array<typename std::decay_t<decltype(list)>::value_type, N> frozen{};
+	size_t index = 0;
+	for (const auto& value : list)
+	{
+		frozen[index] = value;
+		++index;
+	}
+	return frozen;
+}
+
+#endif // __cpp_constexpr_dynamic_alloc
+
+// Развёрнутый (unrolled) односвязный список: каждый узел хранит не один элемент,
+// а небольшой встроенный массив из ChunkCapacity элементов.
+// Для маленьких типов это убирает накладные расходы указателя next_node на каждый элемент,
+// а обход идёт по непрерывному массиву внутри узла и лишь изредка переходит по указателю —
+// существенно меньше промахов кеша на сканирующих нагрузках
+template <typename Type, size_t ChunkCapacity = 8u>
+class UnrolledLinkedList
+{
+	static_assert(ChunkCapacity > 0u, "ChunkCapacity должен быть больше нуля");
+
+private:
+	// Узел-чанк: встроенный массив элементов + счётчик занятых ячеек.
+	// Элементы конструируются на месте в сырой памяти, поэтому Type
+	// не обязан быть default-constructible
+	struct Chunk
+	{
+		alignas(Type) unsigned char storage[sizeof(Type) * ChunkCapacity];
+		size_t count = 0;
+		Chunk* next_chunk = nullptr;
+
+		Type* Values() noexcept
+		{
+			return reinterpret_cast<Type*>(storage);
+		}
+
+		const Type* Values() const noexcept
+		{
+			return reinterpret_cast<const Type*>(storage);
+		}
+	};
+
+	// Итератор по развёрнутому списку: идёт по массиву внутри чанка,
+	// а по указателю next_chunk переходит только на границе чанков
+	template <typename ValueType>
+	class BasicIterator
+	{
+	private:
+		friend class UnrolledLinkedList;
+
+		BasicIterator(Chunk* chunk, size_t index) noexcept
+			: chunk_(chunk)
+			, index_(index)
+		{
+
+		}
+
+	public:
+		using iterator_category = std::forward_iterator_tag;
+		using value_type = Type;
+		using difference_type = std::ptrdiff_t;
+		using pointer = ValueType*;
+		using reference = ValueType&;
+
+		BasicIterator() = default;
+
+		BasicIterator(const BasicIterator<Type>& other) noexcept
+			: chunk_(other.chunk_)
+			, index_(other.index_)
+		{
+
+		}
+
+		BasicIterator& operator=(const BasicIterator& rhs) = default;
+
+		[[nodiscard]] bool operator==(const BasicIterator<const Type>& rhs) const noexcept
+		{
+			return (chunk_ == rhs.chunk_) && (index_ == rhs.index_);
+		}
+
+		[[nodiscard]] bool operator!=(const BasicIterator<const Type>& rhs) const noexcept
+		{
+			return !(*this == rhs);
+		}
+
+		[[nodiscard]] bool operator==(const BasicIterator<Type>& rhs) const noexcept
+		{
+			return (chunk_ == rhs.chunk_) && (index_ == rhs.index_);
+		}
+
+		[[nodiscard]] bool operator!=(const BasicIterator<Type>& rhs) const noexcept
+		{
+			return !(*this == rhs);
+		}
+
+		BasicIterator& operator++() noexcept
+		{
+			if (chunk_)
+			{
+				++index_;
+				if (index_ == chunk_->count)
+				{
+					// Чанк исчерпан — переходим к следующему
+					chunk_ = chunk_->next_chunk;
+					index_ = 0;
+				}
+			}
+			else
+			{
+				assert(false);
+			}
+			return *this;
+		}
+
+		BasicIterator operator++(int) noexcept
+		{
+			BasicIterator old_this(*this);
+			++(*this);
+			return old_this;
+		}
+
+		[[nodiscard]] reference operator*() const noexcept
+		{
+			assert(chunk_);
+			return chunk_->Values()[index_];
+		}
+
+		[[nodiscard]] pointer operator->() const noexcept
+		{
+			assert(chunk_);
+			return &(chunk_->Values()[index_]);
+		}
+
+	private:
+		Chunk* chunk_ = nullptr;
+		size_t index_ = 0;
+	};
+
+private:
+	Chunk* head_chunk_ = nullptr;
+	Chunk* tail_chunk_ = nullptr;
+	size_t size_ = 0;
+
+public:
+	using value_type = Type;
+	using reference = value_type&;
+	using const_reference = const value_type&;
+	using Iterator = BasicIterator<Type>;
+	using ConstIterator = BasicIterator<const Type>;
+
+public:
+
+	UnrolledLinkedList() = default;
+
+	UnrolledLinkedList(std::initializer_list<Type> values)
+	{
+		UnrolledLinkedList temp;
+		for (const auto& value : values)
+		{
+			temp.PushBack(value);
+		}
+		swap(temp);
+	}
+
+	UnrolledLinkedList(const UnrolledLinkedList& other)
+	{
+		UnrolledLinkedList temp;
+		for (const auto& value : other)
+		{
+			temp.PushBack(value);
+		}
+		swap(temp);
+	}
+
+	UnrolledLinkedList& operator=(const UnrolledLinkedList& rhs)
+	{
+		if (this != &rhs)
+		{
+			UnrolledLinkedList temp(rhs);
+			swap(temp);
+		}
+		return *this;
+	}
+
+	UnrolledLinkedList(UnrolledLinkedList&& other) noexcept
+	{
+		swap(other);
+	}
+
+	UnrolledLinkedList& operator=(UnrolledLinkedList&& rhs) noexcept
+	{
+		if (this != &rhs)
+		{
+			UnrolledLinkedList temp(std::move(rhs));
+			swap(temp);
+		}
+		return *this;
+	}
+
+	~UnrolledLinkedList()
+	{
+		Clear();
+	}
+
+	// Обменивает содержимое списков за время O(1)
+	void swap(UnrolledLinkedList& other) noexcept
+	{
+		std::swap(head_chunk_, other.head_chunk_);
+		std::swap(tail_chunk_, other.tail_chunk_);
+		std::swap(size_, other.size_);
+	}
+
+	// Вставляет элемент в конец списка. Амортизированно O(1):
+	// новый чанк выделяется только раз в ChunkCapacity вставок
+	void PushBack(const Type& value)
+	{
+		if (!tail_chunk_ || tail_chunk_->count == ChunkCapacity)
+		{
+			Chunk* new_chunk = new Chunk();
+			if (tail_chunk_)
+			{
+				tail_chunk_->next_chunk = new_chunk;
+			}
+			else
+			{
+				head_chunk_ = new_chunk;
+			}
+			tail_chunk_ = new_chunk;
+		}
+		new (tail_chunk_->Values() + tail_chunk_->count) Type(value);
+		++(tail_chunk_->count);
+		++size_;
+	}
+
+	// Вставляет элемент в начало списка. Если в головном чанке есть место,
+	// элементы сдвигаются внутри массива; иначе выделяется новый головной чанк
+	void PushFront(const Type& value)
+	{
+		if (head_chunk_ && head_chunk_->count < ChunkCapacity)
+		{
+			Type* values = head_chunk_->Values();
+			const size_t count = head_chunk_->count;
+			if (count != 0)
+			{
+				// Сдвигаем занятые ячейки на одну вправо, начиная с конца
+				new (values + count) Type(std::move(values[count - 1]));
+				for (size_t i = count - 1; i > 0; --i)
+				{
+					values[i] = std::move(values[i - 1]);
+				}
+				values[0] = value;
+			}
+			else
+			{
+				new (values) Type(value);
+			}
+			++(head_chunk_->count);
+		}
+		else
+		{
+			Chunk* new_chunk = new Chunk();
+			new (new_chunk->Values()) Type(value);
+			new_chunk->count = 1;
+			new_chunk->next_chunk = head_chunk_;
+			head_chunk_ = new_chunk;
+			if (!tail_chunk_)
+			{
+				tail_chunk_ = new_chunk;
+			}
+		}
+		++size_;
+	}
+
+	// Очищает список за время O(N)
+	void Clear() noexcept
+	{
+		while (head_chunk_)
+		{
+			Chunk* next = head_chunk_->next_chunk;
+			for (size_t i = 0; i < head_chunk_->count; ++i)
+			{
+				head_chunk_->Values()[i].~Type();
+			}
+			delete head_chunk_;
+			head_chunk_ = next;
+		}
+		tail_chunk_ = nullptr;
+		size_ = 0;
+	}
+
+	[[nodiscard]] size_t GetSize() const noexcept
+	{
+		return size_;
+	}
+
+	[[nodiscard]] bool IsEmpty() const noexcept
+	{
+		return size_ == 0;
+	}
+
+	[[nodiscard]] Iterator begin() noexcept
+	{
+		return Iterator(head_chunk_, 0);
+	}
+
+	[[nodiscard]] Iterator end() noexcept
+	{
+		return Iterator();
+	}
+
+	[[nodiscard]] ConstIterator begin() const noexcept
+	{
+		return ConstIterator(head_chunk_, 0);
+	}
+
+	[[nodiscard]] ConstIterator end() const noexcept
+	{
+		return ConstIterator();
+	}
+
+	[[nodiscard]] ConstIterator cbegin() const noexcept
+	{
+		return begin();
+	}
+
+	[[nodiscard]] ConstIterator cend() const noexcept
+	{
+		return end();
+	}
+
+	/*
+	 * Находит первый элемент, равный value. Возвращает end(), если такого нет.
+	 * Внутри чанка поиск идёт по непрерывному массиву простым индексным циклом —
+	 * для арифметических типов компилятор векторизует сравнение (SSE/AVX при -O2/-O3),
+	 * и скорость упирается в пропускную способность памяти, а не в погоню за указателями
+	 */
+	[[nodiscard]] ConstIterator Find(const Type& value) const noexcept
+	{
+		for (Chunk* chunk = head_chunk_; chunk; chunk = chunk->next_chunk)
+		{
+			const Type* values = chunk->Values();
+			for (size_t i = 0; i < chunk->count; ++i)
+			{
+				if (values[i] == value)
+				{
+					return ConstIterator(chunk, i);
+				}
+			}
+		}
+		return end();
+	}
+
+	// Подсчитывает элементы, равные value. Для арифметических типов цикл по чанку
+	// написан безветвлёно (сумма результатов сравнения) и автовекторизуется
+	[[nodiscard]] size_t Count(const Type& value) const noexcept
+	{
+		size_t result = 0;
+		for (const Chunk* chunk = head_chunk_; chunk; chunk = chunk->next_chunk)
+		{
+			const Type* values = chunk->Values();
+			if constexpr (std::is_arithmetic_v<Type>)
+			{
+				size_t chunk_matches = 0;
+				for (size_t i = 0; i < chunk->count; ++i)
+				{
+					chunk_matches += static_cast<size_t>(values[i] == value);
+				}
+				result += chunk_matches;
+			}
+			else
+			{
+				for (size_t i = 0; i < chunk->count; ++i)
+				{
+					if (values[i] == value)
+					{
+						++result;
+					}
+				}
+			}
+		}
+		return result;
+	}
+
+	// Свёртка: acc = op(acc, элемент) по всем элементам в порядке списка.
+	// Тело цикла работает по непрерывному массиву чанка, поэтому для простых операций
+	// над арифметическими типами доступна автовекторизация
+	template <typename Accum, typename Operation>
+	[[nodiscard]] Accum Accumulate(Accum init, Operation op) const
+	{
+		for (const Chunk* chunk = head_chunk_; chunk; chunk = chunk->next_chunk)
+		{
+			const Type* values = chunk->Values();
+			for (size_t i = 0; i < chunk->count; ++i)
+			{
+				init = op(std::move(init), values[i]);
+			}
+		}
+		return init;
+	}
+};
+
+template <typename Type, size_t ChunkCapacity>
+void swap(UnrolledLinkedList<Type, ChunkCapacity>& lhs, UnrolledLinkedList<Type, ChunkCapacity>& rhs) noexcept
+{
+	lhs.swap(rhs);
+}
+
+template <typename Type, size_t ChunkCapacity>
+bool operator==(const UnrolledLinkedList<Type, ChunkCapacity>& lhs, const UnrolledLinkedList<Type, ChunkCapacity>& rhs)
+{
+	return std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+}
+
+template <typename Type, size_t ChunkCapacity>
+bool operator!=(const UnrolledLinkedList<Type, ChunkCapacity>& lhs, const UnrolledLinkedList<Type, ChunkCapacity>& rhs)
 {
-	return (!(lhs < rhs)) ? true : false;
+	return !(lhs == rhs);
 }
\ No newline at end of file
@@ -0,0 +1,432 @@
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+// Односвязный список с малым встроенным буфером (small-buffer optimization).
+//
+// Первые InlineCapacity узлов размещаются во встроенном хранилище прямо внутри
+// объекта списка, рядом с head_ и size_: короткий список (а таких подавляющее
+// большинство) не делает ни одного обращения к куче, а его узлы лежат
+// в одной-двух кеш-линиях с самим объектом. Узлы сверх ёмкости выделяются
+// в куче обычным new; при удалениях встроенные ячейки возвращаются
+// во внутренний свободный список и переиспользуются.
+//
+// Цена оптимизации — адрес встроенного узла привязан к адресу объекта,
+// поэтому перемещение и swap не могут просто обменять указатели: они переносят
+// элементы по одному (O(N), но N здесь по определению мал). По этой же причине
+// это отдельный класс, а не политика SingleLinkedList: Append/SpliceAfter/StealAll
+// основного списка перевешивают чужие цепочки как есть, что со встроенными
+// узлами невозможно
+template <typename Type, size_t InlineCapacity = 4u>
+class SmallSingleLinkedList
+{
+	static_assert(InlineCapacity > 0u, "InlineCapacity должен быть больше нуля");
+
+private:
+	// Узел списка — как у SingleLinkedList
+	struct Node
+	{
+		Node() = default;
+
+		Node(const Type& val, Node* next)
+			: value(val)
+			, next_node(next)
+		{
+
+		}
+
+		template <typename... Args>
+		explicit Node(Node* next, Args&&... args)
+			: value(std::forward<Args>(args)...)
+			, next_node(next)
+		{
+
+		}
+
+		Type value;
+		Node* next_node = nullptr;
+	};
+
+	// Фиктивный узел для вставки "перед первым элементом"
+	Node head_;
+	size_t size_ = 0;
+	// Сырое встроенное хранилище на InlineCapacity узлов
+	alignas(Node) unsigned char inline_storage_[sizeof(Node) * InlineCapacity];
+	// Свободные встроенные ячейки, связанные через поле next_node
+	Node* inline_free_ = nullptr;
+	// Сколько узлов сейчас живёт в куче (для IsFullyInline и тестов)
+	size_t heap_nodes_ = 0;
+
+	[[nodiscard]] Node* InlineSlot(size_t index) noexcept
+	{
+		return reinterpret_cast<Node*>(inline_storage_ + index * sizeof(Node));
+	}
+
+	// Проверяет, лежит ли узел во встроенном хранилище этого объекта
+	[[nodiscard]] bool IsInlineNode(const Node* node) const noexcept
+	{
+		const auto address = reinterpret_cast<uintptr_t>(node);
+		const auto begin = reinterpret_cast<uintptr_t>(inline_storage_);
+		return address >= begin && address < begin + sizeof(inline_storage_);
+	}
+
+	// Связывает все встроенные ячейки в свободный список
+	void InitInlineFreeList() noexcept
+	{
+		inline_free_ = nullptr;
+		for (size_t i = InlineCapacity; i > 0; --i)
+		{
+			Node* slot = InlineSlot(i - 1);
+			slot->next_node = inline_free_;
+			inline_free_ = slot;
+		}
+	}
+
+	// Конструирует узел во встроенной ячейке, если она есть, иначе в куче.
+	// При исключении из конструктора значения ячейка возвращается на место
+	template <typename... Args>
+	Node* CreateNode(Node* next, Args&&... args)
+	{
+		if (inline_free_)
+		{
+			Node* slot = std::exchange(inline_free_, inline_free_->next_node);
+			try
+			{
+				return new (slot) Node(next, std::forward<Args>(args)...);
+			}
+			catch (...)
+			{
+				slot->next_node = inline_free_;
+				inline_free_ = slot;
+				throw;
+			}
+		}
+		Node* node = new Node(next, std::forward<Args>(args)...);
+		++heap_nodes_;
+		return node;
+	}
+
+	// Разрушает узел; встроенная ячейка уходит в свободный список, кучная — в delete
+	void DestroyNode(Node* node) noexcept
+	{
+		if (IsInlineNode(node))
+		{
+			node->~Node();
+			node->next_node = inline_free_;
+			inline_free_ = node;
+		}
+		else
+		{
+			delete node;
+			--heap_nodes_;
+		}
+	}
+
+	// Переносит элементы из other в конец этого (пустого) списка по одному:
+	// встроенные узлы донора привязаны к его адресу и переехать не могут
+	template <typename SourceList>
+	void AppendElementsFrom(SourceList&& other)
+	{
+		Node* last = &head_;
+		for (auto& value : other)
+		{
+			if constexpr (std::is_rvalue_reference_v<SourceList&&>)
+			{
+				last->next_node = CreateNode(nullptr, std::move(value));
+			}
+			else
+			{
+				last->next_node = CreateNode(nullptr, value);
+			}
+			last = last->next_node;
+			++size_;
+		}
+	}
+
+public:
+	using value_type = Type;
+	using reference = value_type&;
+	using const_reference = const value_type&;
+
+	static constexpr size_t kInlineCapacity = InlineCapacity;
+
+	// Forward-итератор; ValueType — Type либо const Type
+	template <typename ValueType>
+	class BasicIterator
+	{
+	private:
+		friend class SmallSingleLinkedList;
+
+		Node* node_ = nullptr;
+
+		explicit BasicIterator(Node* node) noexcept
+			: node_(node)
+		{
+
+		}
+
+	public:
+		using iterator_category = std::forward_iterator_tag;
+		using value_type = Type;
+		using difference_type = std::ptrdiff_t;
+		using pointer = ValueType*;
+		using reference = ValueType&;
+
+		BasicIterator() = default;
+
+		BasicIterator(const BasicIterator<Type>& other) noexcept
+			: node_(other.node_)
+		{
+
+		}
+
+		BasicIterator& operator=(const BasicIterator& rhs) = default;
+
+		[[nodiscard]] bool operator==(const BasicIterator<const Type>& rhs) const noexcept
+		{
+			return node_ == rhs.node_;
+		}
+
+		[[nodiscard]] bool operator!=(const BasicIterator<const Type>& rhs) const noexcept
+		{
+			return !(*this == rhs);
+		}
+
+		[[nodiscard]] bool operator==(const BasicIterator<Type>& rhs) const noexcept
+		{
+			return node_ == rhs.node_;
+		}
+
+		[[nodiscard]] bool operator!=(const BasicIterator<Type>& rhs) const noexcept
+		{
+			return !(*this == rhs);
+		}
+
+		BasicIterator& operator++() noexcept
+		{
+			assert(node_);
+			node_ = node_->next_node;
+			return *this;
+		}
+
+		BasicIterator operator++(int) noexcept
+		{
+			BasicIterator old_this(*this);
+			++(*this);
+			return old_this;
+		}
+
+		[[nodiscard]] reference operator*() const noexcept
+		{
+			assert(node_);
+			return node_->value;
+		}
+
+		[[nodiscard]] pointer operator->() const noexcept
+		{
+			assert(node_);
+			return &(node_->value);
+		}
+	};
+
+	using Iterator = BasicIterator<Type>;
+	using ConstIterator = BasicIterator<const Type>;
+
+	SmallSingleLinkedList()
+	{
+		InitInlineFreeList();
+	}
+
+	SmallSingleLinkedList(std::initializer_list<Type> values)
+		: SmallSingleLinkedList()
+	{
+		AppendElementsFrom(values);
+	}
+
+	SmallSingleLinkedList(const SmallSingleLinkedList& other)
+		: SmallSingleLinkedList()
+	{
+		AppendElementsFrom(other);
+	}
+
+	SmallSingleLinkedList& operator=(const SmallSingleLinkedList& rhs)
+	{
+		if (this != &rhs)
+		{
+			SmallSingleLinkedList temp(rhs);
+			swap(temp);
+		}
+		return *this;
+	}
+
+	// Перемещение переносит элементы по одному (см. комментарий к классу):
+	// встроенные узлы нельзя перевесить между объектами
+	SmallSingleLinkedList(SmallSingleLinkedList&& other)
+		: SmallSingleLinkedList()
+	{
+		AppendElementsFrom(std::move(other));
+		other.Clear();
+	}
+
+	SmallSingleLinkedList& operator=(SmallSingleLinkedList&& rhs)
+	{
+		if (this != &rhs)
+		{
+			Clear();
+			AppendElementsFrom(std::move(rhs));
+			rhs.Clear();
+		}
+		return *this;
+	}
+
+	~SmallSingleLinkedList()
+	{
+		Clear();
+	}
+
+	// Обменивает содержимое списков. В отличие от SingleLinkedList это O(N + M):
+	// элементы переносятся через временный список, т.к. встроенные узлы неподвижны
+	void swap(SmallSingleLinkedList& other)
+	{
+		SmallSingleLinkedList temp(std::move(other));
+		other = std::move(*this);
+		*this = std::move(temp);
+	}
+
+	// Вставляет элемент в начало: пока встроенный буфер не исчерпан — без кучи
+	void PushFront(const Type& value)
+	{
+		head_.next_node = CreateNode(head_.next_node, value);
+		++size_;
+	}
+
+	void PushFront(Type&& value)
+	{
+		head_.next_node = CreateNode(head_.next_node, std::move(value));
+		++size_;
+	}
+
+	// Удаляет первый элемент; его встроенная ячейка становится доступной повторно
+	void PopFront() noexcept
+	{
+		assert(head_.next_node);
+		DestroyNode(std::exchange(head_.next_node, head_.next_node->next_node));
+		--size_;
+	}
+
+	// Вставляет элемент после pos. Возвращает итератор на вставленный элемент
+	Iterator InsertAfter(ConstIterator pos, const Type& value)
+	{
+		assert(pos.node_);
+		pos.node_->next_node = CreateNode(pos.node_->next_node, value);
+		++size_;
+		return Iterator(pos.node_->next_node);
+	}
+
+	// Удаляет элемент, следующий за pos. Возвращает итератор на элемент за удалённым
+	Iterator EraseAfter(ConstIterator pos) noexcept
+	{
+		assert(pos.node_ && pos.node_->next_node);
+		DestroyNode(std::exchange(pos.node_->next_node, pos.node_->next_node->next_node));
+		--size_;
+		return Iterator(pos.node_->next_node);
+	}
+
+	void Clear() noexcept
+	{
+		while (head_.next_node)
+		{
+			PopFront();
+		}
+	}
+
+	[[nodiscard]] size_t GetSize() const noexcept
+	{
+		return size_;
+	}
+
+	[[nodiscard]] bool IsEmpty() const noexcept
+	{
+		return size_ == 0;
+	}
+
+	// Истина, пока список не выходил за встроенный буфер (нет узлов в куче)
+	[[nodiscard]] bool IsFullyInline() const noexcept
+	{
+		return heap_nodes_ == 0;
+	}
+
+	[[nodiscard]] Iterator before_begin() noexcept
+	{
+		return Iterator(&head_);
+	}
+
+	[[nodiscard]] ConstIterator cbefore_begin() const noexcept
+	{
+		return ConstIterator(const_cast<Node*>(&head_));
+	}
+
+	[[nodiscard]] ConstIterator before_begin() const noexcept
+	{
+		return cbefore_begin();
+	}
+
+	[[nodiscard]] Iterator begin() noexcept
+	{
+		return (size_) ? Iterator(head_.next_node) : Iterator();
+	}
+
+	[[nodiscard]] Iterator end() noexcept
+	{
+		return Iterator();
+	}
+
+	[[nodiscard]] ConstIterator begin() const noexcept
+	{
+		return (size_) ? ConstIterator(head_.next_node) : ConstIterator();
+	}
+
+	[[nodiscard]] ConstIterator end() const noexcept
+	{
+		return ConstIterator();
+	}
+
+	[[nodiscard]] ConstIterator cbegin() const noexcept
+	{
+		return begin();
+	}
+
+	[[nodiscard]] ConstIterator cend() const noexcept
+	{
+		return end();
+	}
+};
+
+template <typename Type, size_t InlineCapacity>
+void swap(SmallSingleLinkedList<Type, InlineCapacity>& lhs, SmallSingleLinkedList<Type, InlineCapacity>& rhs)
+{
+	lhs.swap(rhs);
+}
+
+template <typename Type, size_t InlineCapacity>
+bool operator==(const SmallSingleLinkedList<Type, InlineCapacity>& lhs, const SmallSingleLinkedList<Type, InlineCapacity>& rhs)
+{
+	if (lhs.GetSize() != rhs.GetSize())
+	{
+		return false;
+	}
+	return std::equal(lhs.begin(), lhs.end(), rhs.begin());
+}
+
+template <typename Type, size_t InlineCapacity>
+bool operator!=(const SmallSingleLinkedList<Type, InlineCapacity>& lhs, const SmallSingleLinkedList<Type, InlineCapacity>& rhs)
+{
+	return !(lhs == rhs);
+}